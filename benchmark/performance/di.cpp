@@ -1711,8 +1711,8 @@ EXPOSED_OR_AUTO(di::injector<c9>, auto) module10() noexcept {
 };
 #endif
 
-int main() {
-  auto injector = di::make_injector(
+auto make_app_injector() {
+  return di::make_injector(
 #if defined(MODULE1)
       module1()
 #endif
@@ -1762,6 +1762,18 @@ int main() {
       module10()
 #endif
           );
+}
+
+#if defined(EXTERN_CREATE) || defined(INSTANTIATE_CREATE)
+using app_injector = decltype(make_app_injector());
+BOOST_DI_EXTERN_CREATE(app_injector, COMPLEX);
+#endif
 
+int main() {
+  auto injector = make_app_injector();
   injector.create<COMPLEX>();
 }
+
+#if defined(INSTANTIATE_CREATE)
+BOOST_DI_INSTANTIATE_CREATE(app_injector, COMPLEX)
+#endif
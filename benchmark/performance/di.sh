@@ -55,6 +55,14 @@ benchmark() {
   cat /tmp/$0.dat | grep real | awk '{print $2}' | sed "s/0m\(.*\)s/\1/" | tr '\n' ' '
 }
 
+plot() {
+  IFS=',' read -ra titles <<< "$1"
+  for ((i=0; i<${#titles[@]}; ++i)); do
+    [ $i -ne 0 ] && echo -n ', "" '
+    echo -n "using 1:$((i+2)) title \"${titles[$i]}\""
+  done
+}
+
 graph() {
   rm -f $1.pg $1.dat
   `echo $1` > $1.dat
@@ -65,11 +73,7 @@ graph() {
        set key reverse Left outside
        set grid
        set style data linespoints
-       plot \"$1.dat\" \
-          using 1:2 title \"ctor/all\" \
-       , \"\" using 1:3 title \"inject/all\" \
-       , \"\" using 1:4 title \"ctor/exposed\" \
-       , \"\" using 1:5 title \"inject/exposed\"
+       plot \"$1.dat\" `plot ${3:-"ctor/all,inject/all,ctor/exposed,inject/exposed"}`
   " > $1.pg
   gnuplot $1.pg > $1.png
 }
@@ -108,6 +112,16 @@ big_complexity() {
   done
 }
 
+extern_complexity() {
+  for ((i=0; i<=10; ++i)); do
+    echo -n "$((i*20)) "
+    benchmark medium_complexity ctor exposed "bind_others $i" "-c -o /dev/null"
+    benchmark medium_complexity ctor exposed "bind_others $i" "-c -o /dev/null -DEXTERN_CREATE"
+    benchmark medium_complexity ctor exposed "bind_others $i" "-c -o /dev/null -DINSTANTIATE_CREATE"
+    echo
+  done
+}
+
 verify() {
   echo -n "$1[$MAX] "
   [ $(echo "$1 < $MAX" | bc) -ne 1 ] && exit -1
@@ -130,5 +144,6 @@ quick() {
 [[ $COMPLEXITY == *"small"* ]] && graph small_complexity "Small complexity | $CXX $CXXFLAGS"
 [[ $COMPLEXITY == *"medium"* ]] && graph medium_complexity "Medium complexity | $CXX $CXXFLAGS"
 [[ $COMPLEXITY == *"big"* ]] &&  graph big_complexity "Big complexity | $CXX $CXXFLAGS"
+[[ $COMPLEXITY == *"extern"* ]] && graph extern_complexity "Extern create | $CXX $CXXFLAGS" "create,extern,instantiate"
 [[ $COMPLEXITY == *"quick"* ]] && quick
 
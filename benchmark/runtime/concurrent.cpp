@@ -0,0 +1,158 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+namespace {
+
+#if !defined(ITERATIONS)
+#define ITERATIONS 1000000
+#endif
+
+#if !defined(ROUNDS)
+#define ROUNDS 1000
+#endif
+
+#if !defined(MAX_THREADS)
+#define MAX_THREADS 64
+#endif
+
+template <class T>
+void do_not_optimize(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile auto sink = &value;
+  (void)sink;
+#endif
+}
+
+struct i {
+  virtual ~i() noexcept = default;
+  virtual int dummy() = 0;
+};
+struct impl : i {
+  impl() { ++ctor_calls(); }
+  int dummy() override { return 0; }
+
+  static std::atomic<int>& ctor_calls() {
+    static std::atomic<int> calls{0};
+    return calls;
+  }
+};
+
+template <class TScope>
+auto make_injector(const TScope& scope) {
+  return di::make_injector(di::bind<i>().template to<impl>().in(scope));
+}
+
+template <class T>
+void run(int threads, const T& thread_main) {
+  std::atomic<int> ready{0};
+  std::atomic<bool> start{false};
+  std::vector<std::thread> workers;
+  for (auto t = 0; t < threads; ++t) {
+    workers.emplace_back([&] {
+      ++ready;
+      while (!start) {
+        std::this_thread::yield();
+      }
+      thread_main();
+    });
+  }
+  while (ready != threads) {
+    std::this_thread::yield();
+  }
+  start = true;
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+template <class TScope>
+double hot(const TScope& scope, int threads) {
+  auto injector = make_injector(scope);
+  i& expected = injector.template create<i&>();
+  std::atomic<bool> failed{false};
+
+  const auto start = std::chrono::steady_clock::now();
+  run(threads, [&] {
+    for (auto n = 0; n < ITERATIONS; ++n) {
+      i& object = injector.template create<i&>();
+      do_not_optimize(object);
+      if (&object != &expected) {
+        failed = true;
+      }
+    }
+  });
+  const auto end = std::chrono::steady_clock::now();
+
+  if (failed) {
+    std::printf("# %d threads resolved different instances\n", threads);
+    std::exit(1);
+  }
+  return std::chrono::duration<double, std::nano>(end - start).count() / ITERATIONS;
+}
+
+template <class T>
+double injected(int threads) {
+  auto injector = make_injector(di::singleton);
+  injector.template create<T>();
+
+  const auto start = std::chrono::steady_clock::now();
+  run(threads, [&] {
+    for (auto n = 0; n < ITERATIONS; ++n) {
+      auto object = injector.template create<T>();
+      do_not_optimize(object);
+    }
+  });
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / ITERATIONS;
+}
+
+template <class TScope>
+double cold(const TScope& scope, int threads) {
+  auto total = 0.0;
+  for (auto round = 0; round < ROUNDS; ++round) {
+    impl::ctor_calls() = 0;
+    auto injector = make_injector(scope);
+    std::vector<i*> objects(threads);
+    std::atomic<int> index{0};
+
+    const auto start = std::chrono::steady_clock::now();
+    run(threads, [&] { objects[index++] = &injector.template create<i&>(); });
+    total += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    for (auto object : objects) {
+      if (object != objects.front() || impl::ctor_calls() != 1) {
+        std::printf("# %d threads created %d instances\n", threads, impl::ctor_calls().load());
+        std::exit(1);
+      }
+    }
+  }
+  return total / ROUNDS;
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%-8s %22s %22s %22s %22s %22s\n", "# threads", "concurrent_scoped ns/op", "singleton ns/op",
+              "concurrent_scoped init ns", "shared_ptr ns/op", "borrowed ns/op");
+  for (auto threads = 1; threads <= MAX_THREADS; threads *= 2) {
+    std::printf("%-9d %22.2f %22.2f %22.2f %22.2f %22.2f\n", threads, hot(di::concurrent_scoped, threads),
+                hot(di::singleton, threads), cold(di::concurrent_scoped, threads), injected<std::shared_ptr<i>>(threads),
+                injected<di::borrowed<i>>(threads));
+  }
+}
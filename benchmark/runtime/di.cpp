@@ -0,0 +1,299 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#if defined(__linux)
+#include <sched.h>
+#endif
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+namespace {
+unsigned long allocations = 0;
+unsigned long bytes = 0;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  ++allocations;
+  bytes += size;
+  if (auto ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  std::abort();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+#if !defined(ITERATIONS)
+#define ITERATIONS 1000000
+#endif
+
+template <class T>
+void do_not_optimize(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile auto sink = &value;
+  (void)sink;
+#endif
+}
+
+struct result {
+  double ns = 0;
+  double allocations = 0;
+  double bytes = 0;
+};
+
+template <class T>
+result measure(const T& create) {
+  for (auto i = 0; i < ITERATIONS / 10; ++i) {
+    auto object = create();
+    do_not_optimize(object);
+  }
+
+  const auto allocations_ = allocations;
+  const auto bytes_ = bytes;
+  const auto start = std::chrono::steady_clock::now();
+  for (auto i = 0; i < ITERATIONS; ++i) {
+    auto object = create();
+    do_not_optimize(object);
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  return {std::chrono::duration<double, std::nano>(end - start).count() / ITERATIONS,
+          static_cast<double>(allocations - allocations_) / ITERATIONS, static_cast<double>(bytes - bytes_) / ITERATIONS};
+}
+
+template <class TDi, class TBase>
+void benchmark(const char* name, const TDi& given, const TBase& expected) {
+  const auto di = measure(given);
+  const auto base = measure(expected);
+  std::printf("%-16s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f %8.2f\n", name, di.ns, di.allocations, di.bytes, base.ns,
+              base.allocations, base.bytes, base.ns > 0 ? di.ns / base.ns : 0);
+}
+
+void pin(int cpu) {
+#if defined(__linux)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  if (sched_setaffinity(0, sizeof(set), &set)) {
+    std::printf("# unable to pin to cpu %d\n", cpu);
+  }
+#else
+  (void)cpu;
+#endif
+}
+
+struct i {
+  virtual ~i() noexcept = default;
+  virtual int dummy() = 0;
+};
+struct impl : i {
+  explicit impl(int i) : i_(i) {}
+  int dummy() override { return i_; }
+  int i_ = 0;
+};
+struct impl2 : i {
+  int dummy() override { return 0; }
+};
+
+struct unique {
+  unique(int i, double d) : i(i), d(d) {}
+  int i = 0;
+  double d = 0;
+};
+
+struct singleton {
+  int i = 0;
+};
+
+struct instance {
+  explicit instance(int i) : i(i) {}
+  int i = 0;
+};
+
+auto name = [] {};
+struct named {
+  BOOST_DI_INJECT(explicit named, (named = name) int i) : i(i) {}
+  int i = 0;
+};
+
+struct interfaces {
+  interfaces(std::unique_ptr<i> i1, std::shared_ptr<i> i2) : i1(std::move(i1)), i2(i2) {}
+  std::unique_ptr<i> i1;
+  std::shared_ptr<i> i2;
+};
+
+template <int Depth, int MaxDepth = 4>
+struct tree {
+  tree(tree<Depth + 1, MaxDepth> t1, tree<Depth + 1, MaxDepth> t2, tree<Depth + 1, MaxDepth> t3,
+       tree<Depth + 1, MaxDepth> t4)
+      : i(t1.i + t2.i + t3.i + t4.i) {}
+  int i = 0;
+};
+
+template <int MaxDepth>
+struct tree<MaxDepth, MaxDepth> {
+  tree() : i(1) {}
+  int i = 0;
+};
+
+template <int Depth, int MaxDepth = 4>
+struct make_tree {
+  static tree<Depth, MaxDepth> create() {
+    return {make_tree<Depth + 1, MaxDepth>::create(), make_tree<Depth + 1, MaxDepth>::create(),
+            make_tree<Depth + 1, MaxDepth>::create(), make_tree<Depth + 1, MaxDepth>::create()};
+  }
+};
+
+template <int MaxDepth>
+struct make_tree<MaxDepth, MaxDepth> {
+  static tree<MaxDepth, MaxDepth> create() { return {}; }
+};
+
+auto module() { return di::make_injector(di::bind<i>().to<impl>(), di::bind<int>().to(42)); }
+
+di::injector<std::unique_ptr<i>> exposed_module() {
+  return di::make_injector(di::bind<i>().to<impl>(), di::bind<int>().to(42));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  pin(argc > 1 ? std::atoi(argv[1]) : 0);
+  std::printf("%-16s %10s %10s %10s %10s %10s %10s %8s\n", "# scenario", "ns/op", "allocs/op", "bytes/op", "base ns/op",
+              "allocs/op", "bytes/op", "ratio");
+
+  {
+    auto injector = di::make_injector(di::bind<int>().to(42), di::bind<double>().to(87.0));
+    benchmark("unique", [&] { return injector.create<unique>(); }, [] { return unique{42, 87.0}; });
+    benchmark("unique_ptr", [&] { return injector.create<std::unique_ptr<unique>>(); },
+              [] { return std::make_unique<unique>(42, 87.0); });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<int>().to(42), di::bind<double>().to(87.0));
+    benchmark("create_n", [&] { return injector.create_n<unique>(8); }, [&] {
+      std::vector<std::unique_ptr<unique>> objects;
+      objects.reserve(8);
+      for (auto i = 0; i < 8; ++i) {
+        objects.push_back(injector.create<std::unique_ptr<unique>>());
+      }
+      return objects;
+    });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<int>().to(42), di::bind<double>().to(87.0));
+    alignas(unique) unsigned char storage[sizeof(unique)];
+    benchmark("create_at", [&] { return &injector.create_at<unique>(storage); },
+              [&] { return injector.create<std::unique_ptr<unique>>(); });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<unique>().in(di::pooled), di::bind<int>().to(42), di::bind<double>().to(87.0));
+    benchmark("pooled", [&] { return injector.create<std::unique_ptr<unique, di::pool_return_deleter>>(); },
+              [] { return std::make_unique<unique>(42, 87.0); });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<singleton>().in(di::singleton));
+    const auto object = std::make_shared<singleton>();
+    benchmark("singleton", [&] { return injector.create<std::shared_ptr<singleton>>(); }, [&] { return object; });
+    benchmark("borrowed", [&] { return injector.create<di::borrowed<singleton>>(); }, [&] { return object; });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<singleton>().in(di::thread_local_));
+    benchmark("thread_local", [&] { return &injector.create<singleton&>(); }, [] {
+      static thread_local singleton object;
+      return &object;
+    });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<int>().to(42));
+    benchmark("instance", [&] { return injector.create<instance>(); }, [] { return instance{42}; });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<int>().named(name).to(42));
+    benchmark("named", [&] { return injector.create<named>(); }, [] { return named{42}; });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<i>().to<impl>(), di::bind<int>().to(42));
+    const std::shared_ptr<i> object = std::make_shared<impl>(42);
+    benchmark("interface", [&] { return injector.create<std::unique_ptr<i>>(); },
+              [] { return std::unique_ptr<i>{std::make_unique<impl>(42)}; });
+    benchmark("interfaces", [&] { return injector.create<interfaces>(); },
+              [&] { return interfaces{std::make_unique<impl>(42), object}; });
+    benchmark("poly", [&] { return injector.create<di::poly<i, 16>>(); },
+              [&] { return injector.create<std::unique_ptr<i>>(); });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<i>().to<impl>().in(di::unique), di::bind<int>().to(42));
+    benchmark("shared_ptr", [&] { return injector.create<std::shared_ptr<i>>(); },
+              [] { return std::shared_ptr<i>{std::make_shared<impl>(42)}; });
+  }
+
+  {
+    auto id = 0;
+    using one_of = di::one_of<impl, impl2>;
+    // clang-format off
+    auto injector = di::make_injector(
+      di::bind<one_of>().to<one_of>([&] { return id; }),
+      di::bind<i>().to([&](const auto& injector) -> std::unique_ptr<i> {
+        if (id) {
+          return injector.template create<std::unique_ptr<impl2>>();
+        }
+        return injector.template create<std::unique_ptr<impl>>();
+      }),
+      di::bind<int>().to(42)
+    );
+    // clang-format on
+    benchmark("one_of", [&] { return injector.create<one_of>(); }, [&] { return injector.create<std::unique_ptr<i>>(); });
+  }
+
+  {
+    auto injector = di::make_injector(module());
+    benchmark("module", [&] { return injector.create<std::unique_ptr<i>>(); },
+              [] { return std::unique_ptr<i>{std::make_unique<impl>(42)}; });
+  }
+
+  {
+    auto injector = di::make_injector(exposed_module());
+    benchmark("exposed_module", [&] { return injector.create<std::unique_ptr<i>>(); },
+              [] { return std::unique_ptr<i>{std::make_unique<impl>(42)}; });
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<i* []>().to<impl, impl2>(), di::bind<int>().to(42));
+    benchmark("multi_bindings", [&] { return injector.create<std::vector<std::unique_ptr<i>>>(); }, [] {
+      std::vector<std::unique_ptr<i>> v;
+      v.reserve(2);
+      v.emplace_back(std::make_unique<impl>(42));
+      v.emplace_back(std::make_unique<impl2>());
+      return v;
+    });
+  }
+
+  {
+    auto injector = di::make_injector();
+    benchmark("tree", [&] { return injector.create<tree<0>>(); }, [] { return make_tree<0>::create(); });
+  }
+}
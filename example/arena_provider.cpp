@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <memory>
+//->
+
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+//<-
+struct interface {
+  virtual ~interface() noexcept = default;
+};
+struct implementation : interface {};
+//->
+
+template <class T>
+using arena_ptr = std::unique_ptr<T, di::providers::arena::deleter>;
+
+/*<define `example` class as usual>*/
+struct example {
+  explicit example(int i, arena_ptr<interface> up, std::shared_ptr<interface> sp) {
+    assert(i == 42);
+    assert(dynamic_cast<implementation*>(up.get()));
+    assert(dynamic_cast<implementation*>(sp.get()));
+  }
+};
+
+/*<<caller-supplied monotonic buffer, for example, one per request>>*/
+alignas(16) unsigned char storage[1024];
+di::providers::monotonic_buffer buffer{storage};
+
+/*<override `di` provider configuration>*/
+class config : public di::config {
+ public:
+  static auto provider(...) noexcept { return di::providers::arena{buffer}; }
+};
+
+int main() {
+  /*<<make injector with `arena` provider configuration>>*/
+  // clang-format off
+  auto injector = di::make_injector<config>(
+    di::bind<int>().to(42)
+  , di::bind<interface>().to<implementation>()
+  );
+  // clang-format on
+
+  /*<<create `example` using `arena` provider, all heap objects are allocated from `buffer`>>*/
+  {
+    auto object = injector.create<arena_ptr<example>>();
+    assert(buffer.owns(object.get()));
+  }
+
+  /*<<release all memory at once>>*/
+  buffer.release();
+  assert(!buffer.used());
+}
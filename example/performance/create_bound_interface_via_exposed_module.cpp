@@ -37,30 +37,27 @@ auto test() {
 }
 
 /**
- * ASM x86-64 (additional cost for type erasure)
+ * ASM x86-64 (additional cost for type erasure, injector stored inline, no allocation)
  *
- * push   %r14
  * push   %rbx
- * push   %rax
- * mov    %rdi,%r14
- * mov    $0x18,%edi
- * callq  0x4008e0 <_Znwm@plt>
- * mov    %rax,%rbx
- * movq   $0x400bb0,(%rbx)
- * movq   $0x400bd0,0x8(%rbx)
- * mov    $0x8,%edi
- * callq  0x4008e0 <_Znwm@plt>
- * movq   $0x400cd8,(%rax)
- * mov    %rax,(%r14)
- * mov    %rbx,%rdi
- * callq  *0x8(%rbx)
- * mov    %rbx,%rdi
- * callq  0x400880 <_ZdlPv@plt>
- * mov    %r14,%rax
- * add    $0x8,%rsp
+ * lea    0x29a8(%rip),%rax  # vtable_impl<injector, inline_storage<injector>>()::object
+ * mov    %rdi,%rbx
+ * sub    $0x60,%rsp
+ * lea    0x8(%rsp),%rdi
+ * lea    0x10(%rsp),%rsi
+ * mov    %rax,0x10(%rsp)
+ * call   0x1460 <dispatch<injector, inline_storage<injector>, named<no_name, std::unique_ptr<interface>>, true_type>::impl>
+ * mov    0x8(%rsp),%rax
+ * mov    %rax,(%rbx)
+ * mov    0x10(%rsp),%rax
+ * test   %rax,%rax
+ * je     0x140d <test()+0x3d>
+ * lea    0x18(%rsp),%rdi
+ * call   *0x10(%rax)
+ * add    $0x60,%rsp
+ * mov    %rbx,%rax
  * pop    %rbx
- * pop    %r14
- * retq
+ * ret
  */
 
 //<-
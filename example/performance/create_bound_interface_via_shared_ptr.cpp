@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cstdlib>
+#include <string>
+#include <memory>
+//->
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+//<-
+struct interface {
+  virtual ~interface() noexcept = default;
+  virtual void dummy() = 0;
+};
+struct implementation : interface {
+  void dummy() override {}
+};
+//->
+
+auto test() {
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<interface>().to<implementation>().in(di::unique)
+  );
+  // clang-format on
+
+  return injector.create<std::shared_ptr<interface>>();
+}
+
+/**
+ * ASM x86-64 (same as `std::make_shared<implementation>()`)
+ *
+ * push   %rbx
+ * mov    %rdi,%rbx
+ * mov    $0x18,%edi
+ * callq  0x401080 <_Znwm@plt>
+ * mov    0xdd3(%rip),%rdx
+ * lea    0x2934(%rip),%rcx
+ * lea    0x2905(%rip),%rsi
+ * mov    %rcx,(%rax)
+ * mov    %rdx,0x8(%rax)
+ * lea    0x10(%rax),%rdx
+ * mov    %rsi,0x10(%rax)
+ * mov    %rax,0x8(%rbx)
+ * mov    %rbx,%rax
+ * mov    %rdx,(%rbx)
+ * pop    %rbx
+ * retq
+ */
+
+//<-
+int main(int, char** argv) {
+  std::system(("gdb -batch -ex 'file " + std::string{argv[0]} + "' -ex 'disassemble test'").c_str());
+}
+//->
@@ -14,41 +14,6 @@
 namespace di = boost::di;
 
 //<-
-BOOST_DI_NAMESPACE_BEGIN namespace wrappers {
-  template <class TScope, class T, class TDeleter>
-  struct unique<TScope, std::unique_ptr<T, TDeleter>> {
-    using scope = TScope;
-
-    template <class I>
-    inline operator I() const noexcept {
-      return *object;
-    }
-
-    template <class I>
-    inline operator I*() noexcept {
-      return object.release();
-    }
-
-    template <class I>
-    inline operator const I*() noexcept {
-      return object.release();
-    }
-
-    template <class I>
-    inline operator std::shared_ptr<I>() noexcept {
-      return {object.release(), object.get_deleter()};
-    }
-
-    template <class I, class D>
-    inline operator std::unique_ptr<I, D>() noexcept {
-      return static_cast<std::unique_ptr<T, TDeleter>&&>(object);
-    }
-
-    std::unique_ptr<T, TDeleter> object;
-  };
-}
-BOOST_DI_NAMESPACE_END
-
 struct interface {
   virtual ~interface() noexcept = default;
 };
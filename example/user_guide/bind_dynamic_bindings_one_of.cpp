@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+struct zlib {
+  explicit zlib(int level) : level(level) {}
+  int compress() const { return level; }
+  int level = 0;
+};
+struct lz4 {
+  int compress() const { return 4; }
+};
+//->
+
+/*<<neither `zlib` nor `lz4` has to implement an interface>>*/
+using compressor = di::one_of<zlib, lz4>;
+
+int main() {
+  auto id = 0;
+
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<int>().to(9),
+    /*<<`id` is the index of the implementation to be created>>*/
+    di::bind<compressor>().to<compressor>([&] { return id; })
+  );
+  // clang-format on
+
+  /*<<`zlib` is constructed in the inline storage of `compressor`, no heap allocation involved>>*/
+  auto object = injector.create<compressor>();
+  assert(9 == object.visit([](const auto& c) { return c.compress(); }));
+
+  id = 1;
+  assert(injector.create<compressor>().get_if<lz4>());
+}
@@ -0,0 +1,49 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <type_traits>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+struct i1 {
+  virtual ~i1() noexcept = default;
+  virtual int get() const = 0;
+};
+struct impl1 final : i1 {
+  int get() const override { return 42; }
+};
+struct mock1 : i1 {
+  int get() const override { return 87; }
+};
+//->
+
+template <class T = di::sealed<i1> /*virtual dispatch by default*/>
+struct app {
+  explicit app(T object) : object(static_cast<T&&>(object)) {}
+  /*<<calls are devirtualized when `T` is `di::sealed<i1, impl1>`>>*/
+  int run() const { return object->get(); }
+  T object;
+};
+
+int main() {
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<i1>().to<impl1>()
+  );
+  // clang-format on
+
+  /*<<`di::sealed_t` resolves `i1` to the bound `impl1`>>*/
+  using sealed = di::sealed_t<decltype(injector), i1>;
+  static_assert(std::is_same<di::sealed<i1, impl1>, sealed>::value, "");
+  assert(42 == injector.create<app<sealed>>().run());
+
+  /*<<test configuration uses the virtual path>>*/
+  auto test_injector = di::make_injector(di::bind<i1>().to<mock1>());
+  assert(87 == test_injector.create<app<>>().run());
+}
@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+//->
+
+struct interface {
+  virtual ~interface() noexcept = default;
+  virtual int get() const = 0;
+};
+
+struct implementation : interface {
+  explicit implementation(int i) : i(i) {}
+  int get() const override { return i; }
+  int i = 0;
+};
+
+struct app {
+  app(interface& i, int id) : i(i), id(id) {}
+  interface& i;
+  int id = 0;
+};
+
+int main() {
+  auto injector = di::make_injector(di::bind<interface>().to<implementation>().in(di::singleton), di::bind<int>().to(42));
+
+  /*<<`app` is constructed directly in `storage`, neither moved nor allocated>>*/
+  alignas(app) unsigned char storage[sizeof(app)];
+  app& a = injector.create_at<app>(storage);
+  assert(static_cast<void*>(&a) == static_cast<void*>(storage));
+  assert(42 == a.id);
+  assert(42 == a.i.get());
+  a.~app();
+
+  /*<<bound interfaces are constructed as their implementation, `storage_t` fits the bound type>>*/
+  auto injector_ = di::make_injector(di::bind<interface>().to<implementation>(), di::bind<int>().to(87));
+  decltype(injector_)::storage_t<interface> buffer;
+  interface& i = injector_.create_at<interface>(&buffer);
+  assert(87 == i.get());
+  i.~interface();
+}
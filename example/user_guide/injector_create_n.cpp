@@ -0,0 +1,41 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <memory>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+//->
+
+struct config {};
+
+struct worker {
+  worker(std::shared_ptr<config> c, int id) : c(c), id(id) {}
+  std::shared_ptr<config> c;
+  int id = 0;
+};
+
+int main() {
+  auto injector = di::make_injector(di::bind<config>().in(di::singleton), di::bind<int>().to(42));
+
+  /*<<8 workers in one contiguous allocation sharing the same `config`>>*/
+  auto workers = injector.create_n<worker>(8);
+  assert(8 == workers.size());
+  assert(&workers[0] + 7 == &workers[7]);
+  for (const auto& w : workers) {
+    assert(workers[0].c == w.c);
+    assert(42 == w.id);
+  }
+
+  /*<<workers created in a caller-supplied buffer>>*/
+  alignas(worker) unsigned char buffer[2 * sizeof(worker)];
+  worker* objects = injector.create_into<worker>(buffer, 2);
+  assert(workers[0].c == objects[1].c);
+  objects[0].~worker();
+  objects[1].~worker();
+}
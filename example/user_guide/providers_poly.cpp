@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <utility>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+//->
+
+struct ilogger {
+  virtual ~ilogger() noexcept = default;
+  virtual int level() const = 0;
+};
+
+struct logger : ilogger {
+  explicit logger(int level) : level_(level) {}
+  int level() const override { return level_; }
+  int level_ = 0;
+};
+
+struct file_logger : logger {
+  using logger::logger;
+  char buffer[256];
+};
+
+struct app {
+  /*<<`ilogger` is stored by value, up to 32 bytes>>*/
+  explicit app(di::poly<ilogger, 32> logger) : logger(std::move(logger)) {}
+  di::poly<ilogger, 32> logger;
+};
+
+int main() {
+  {
+    auto injector = di::make_injector(di::bind<ilogger>().to<logger>(), di::bind<int>().to(42));
+    /*<<`logger` fits, it's constructed inside `app::logger` without an allocation>>*/
+    auto object = injector.create<app>();
+    assert(object.logger.inlined());
+    assert(42 == object.logger->level());
+  }
+
+  {
+    auto injector = di::make_injector(di::bind<ilogger>().to<file_logger>(), di::bind<int>().to(87));
+    /*<<`file_logger` doesn't fit, it's created on the heap>>*/
+    auto object = injector.create<app>();
+    assert(!object.logger.inlined());
+    assert(87 == object.logger->level());
+  }
+}
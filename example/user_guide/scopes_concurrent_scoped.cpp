@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <thread>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+struct i1 {
+  virtual ~i1() noexcept = default;
+  virtual void dummy1() = 0;
+};
+struct impl1 : i1 {
+  void dummy1() override {}
+};
+//->
+
+int main() {
+  // clang-format off
+  auto make_injector = [] {
+    return di::make_injector(
+      di::bind<i1>().in(di::concurrent_scoped).to<impl1>()
+    );
+  };
+  // clang-format on
+
+  auto injector1 = make_injector();
+  auto injector2 = make_injector();
+
+  i1* object1 = nullptr;
+  i1* object2 = nullptr;
+  std::thread t1{[&] { object1 = &injector1.create<i1&>(); }};
+  std::thread t2{[&] { object2 = &injector1.create<i1&>(); }};
+  t1.join();
+  t2.join();
+
+  assert(object1 == object2);
+  assert(object1 != &injector2.create<i1&>());
+}
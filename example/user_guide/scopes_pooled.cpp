@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <memory>
+#include <vector>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+struct i1 {
+  virtual ~i1() noexcept = default;
+  virtual void dummy1() = 0;
+};
+struct impl1 : i1 {
+  void dummy1() override {}
+};
+//->
+
+struct buffer {
+  void reset() { data.clear(); }
+  std::vector<char> data;
+};
+
+int main() {
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<i1>().in(di::pooled).to<impl1>()
+  , di::bind<buffer>().in(di::pooled)
+  );
+  // clang-format on
+
+  i1* object = nullptr;
+  {
+    std::unique_ptr<i1, di::pool_return_deleter> object1 = injector.create<std::unique_ptr<i1, di::pool_return_deleter>>();
+    object = object1.get();
+  }  // `impl1` is destroyed and its memory is returned to the pool
+
+  auto object2 = injector.create<std::unique_ptr<i1, di::pool_return_deleter>>();
+  assert(object == object2.get());
+  assert(1 == di::pooled.statistics<impl1>().hits);
+  assert(1 == di::pooled.statistics<impl1>().misses);
+
+  {
+    auto b = injector.create<std::unique_ptr<buffer, di::pool_return_deleter>>();
+    b->data.resize(1024);
+  }  // `buffer::reset` is called and the object is returned to the pool, keeping its capacity
+
+  auto b = injector.create<std::unique_ptr<buffer, di::pool_return_deleter>>();
+  assert(b->data.empty());
+  assert(b->data.capacity() >= 1024);
+}
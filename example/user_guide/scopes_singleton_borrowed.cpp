@@ -0,0 +1,38 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <memory>
+#include <cassert>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+struct i1 {
+  virtual ~i1() noexcept = default;
+  virtual void dummy1() = 0;
+};
+struct impl1 : i1 {
+  void dummy1() override {}
+};
+//->
+
+struct request {
+  /*<<doesn't own `i1`, so no reference counting is involved>>*/
+  explicit request(di::borrowed<i1> object) : object(object) {}
+  di::borrowed<i1> object;
+};
+
+int main() {
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<i1>().in(di::singleton).to<impl1>()
+  );
+  // clang-format on
+
+  /*<<the same binding might be injected as an owning `std::shared_ptr` as well>>*/
+  assert(injector.create<request>().object.get() == injector.create<std::shared_ptr<i1>>().get());
+}
@@ -0,0 +1,39 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <thread>
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+struct i1 {
+  virtual ~i1() noexcept = default;
+  virtual void dummy1() = 0;
+};
+struct impl1 : i1 {
+  void dummy1() override {}
+};
+//->
+
+int main() {
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<i1>().in(di::thread_local_).to<impl1>()
+  );
+  // clang-format on
+
+  i1* object1 = &injector.create<i1&>();
+  i1* object2 = nullptr;
+  std::thread{[&] {
+    object2 = &injector.create<i1&>();
+    assert(object2 == &injector.create<i1&>());
+  }}.join();
+
+  assert(object1 == &injector.create<i1&>());
+  assert(object1 != object2);
+}
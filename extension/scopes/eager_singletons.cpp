@@ -0,0 +1,444 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+//->
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+namespace eager {
+
+/*<<singletons which might be safely created from many threads>>*/
+template <class>
+struct is_thread_safe : std::false_type {};
+
+template <>
+struct is_thread_safe<di::scopes::singleton> : std::true_type {};
+
+template <>
+struct is_thread_safe<di::scopes::concurrent_scoped> : std::true_type {};
+
+template <class, class = di::aux::type_list<>>
+struct singletons;
+
+template <class... Ts>
+struct singletons<di::aux::type_list<>, di::aux::type_list<Ts...>> {
+  using type = di::aux::type_list<Ts...>;
+};
+
+template <class TDep, class... TDeps, class... Ts>
+struct singletons<di::aux::type_list<TDep, TDeps...>, di::aux::type_list<Ts...>>
+    : singletons<di::aux::type_list<TDeps...>,
+                 std::conditional_t<is_thread_safe<typename TDep::scope>::value &&
+                                        std::is_same<typename TDep::name, di::no_name>::value,
+                                    di::aux::type_list<Ts..., TDep>, di::aux::type_list<Ts...>>> {};
+
+template <class T, class... TDeps>
+constexpr int index_of(const di::aux::type_list<TDeps...>&) {
+  constexpr bool matches[] = {false, std::is_same<T, typename TDeps::expected>::value...};
+  for (auto i = 1u; i < sizeof(matches); ++i) {
+    if (matches[i]) {
+      return i - 1;
+    }
+  }
+  return -1;
+}
+
+template <class>
+struct size;
+
+template <class... Ts>
+struct size<di::aux::type_list<Ts...>> : std::integral_constant<int, sizeof...(Ts)> {};
+
+template <class T>
+struct unnamed {
+  using type = T;
+};
+
+template <class TName, class T>
+struct unnamed<di::named<TName, T>> {
+  using type = T;
+};
+
+/*<<conversions limited to singletons [Begin, End) used to find which parameters of automatically deduced constructors are singletons>>*/
+template <class T, class TParent, class TSingletons, int Begin, int End,
+          int I = index_of<di::aux::decay_t<T>>(TSingletons{})>
+using is_in_range =
+    std::integral_constant<bool, !std::is_same<di::aux::decay_t<T>, TParent>::value && I >= Begin && I < End>;
+
+template <class TParent, class TSingletons, int Begin, int End>
+struct any_singleton {
+  template <class T, std::enable_if_t<is_in_range<T, TParent, TSingletons, Begin, End>::value, int> = 0>
+  operator T();
+
+ private:
+  template <class T, std::enable_if_t<is_in_range<T, TParent, TSingletons, Begin, End>::value, int> = 0>
+  operator const T&() const;
+};
+
+template <class TParent, class TSingletons, int Begin, int End>
+struct any_singleton_ref {
+  template <class T, std::enable_if_t<is_in_range<T, TParent, TSingletons, Begin, End>::value, int> = 0>
+  operator T();
+
+  template <class T, std::enable_if_t<is_in_range<T, TParent, TSingletons, Begin, End>::value, int> = 0>
+  operator T&() const;
+
+  template <class T, std::enable_if_t<is_in_range<T, TParent, TSingletons, Begin, End>::value, int> = 0>
+  operator const T&() const;
+};
+
+template <class>
+struct is_any_type : std::false_type {};
+
+template <class T>
+struct is_any_type<di::core::any_type_fwd<T>> : std::true_type {};
+
+template <class T>
+struct is_any_type<di::core::any_type_1st_fwd<T>> : std::true_type {};
+
+template <class>
+struct is_any_type_ref : std::false_type {};
+
+template <class T>
+struct is_any_type_ref<di::core::any_type_ref_fwd<T>> : std::true_type {};
+
+template <class T>
+struct is_any_type_ref<di::core::any_type_1st_ref_fwd<T>> : std::true_type {};
+
+template <class, class, class, class, int, class>
+struct is_creatable_with;
+
+template <class T, class... TArgs, std::size_t... Ns, int N, class TAny>
+struct is_creatable_with<di::type_traits::direct, T, di::aux::type_list<TArgs...>, std::index_sequence<Ns...>, N, TAny>
+    : di::aux::is_constructible<T, std::conditional_t<int(Ns) == N, TAny, TArgs>...> {};
+
+template <class T, class... TArgs, std::size_t... Ns, int N, class TAny>
+struct is_creatable_with<di::type_traits::uniform, T, di::aux::type_list<TArgs...>, std::index_sequence<Ns...>, N, TAny>
+    : di::aux::is_braces_constructible<T, std::conditional_t<int(Ns) == N, TAny, TArgs>...> {};
+
+template <class TInit, class T, class TArgs, class TSingletons, int N, class TArg, int Begin, int End>
+using is_creatable_with_singleton = is_creatable_with<
+    TInit, T, TArgs, std::make_index_sequence<size<TArgs>::value>, N,
+    std::conditional_t<is_any_type_ref<TArg>::value, any_singleton_ref<T, TSingletons, Begin, End>,
+                       any_singleton<T, TSingletons, Begin, End>>>;
+
+/*<<binary search of singletons convertible to `N`th parameter>>*/
+template <class TInit, class T, class TArgs, class TSingletons, int N, class TArg, int Begin, int End,
+          bool = is_creatable_with_singleton<TInit, T, TArgs, TSingletons, N, TArg, Begin, End>::value,
+          bool = (End - Begin == 1)>
+struct find_singleton {
+  static void apply(std::vector<int>&) {}
+};
+
+template <class TInit, class T, class TArgs, class TSingletons, int N, class TArg, int Begin, int End>
+struct find_singleton<TInit, T, TArgs, TSingletons, N, TArg, Begin, End, true, true> {
+  static void apply(std::vector<int>& dependencies) { dependencies.push_back(Begin); }
+};
+
+template <class TInit, class T, class TArgs, class TSingletons, int N, class TArg, int Begin, int End>
+struct find_singleton<TInit, T, TArgs, TSingletons, N, TArg, Begin, End, true, false> {
+  static void apply(std::vector<int>& dependencies) {
+    find_singleton<TInit, T, TArgs, TSingletons, N, TArg, Begin, (Begin + End) / 2>::apply(dependencies);
+    find_singleton<TInit, T, TArgs, TSingletons, N, TArg, (Begin + End) / 2, End>::apply(dependencies);
+  }
+};
+
+template <class TInit, class T, class TArgs, class TSingletons, int N, class TArg,
+          bool = is_any_type<TArg>::value || is_any_type_ref<TArg>::value>
+struct parameter_dependencies {
+  static void apply(std::vector<int>& dependencies) {
+    find_singleton<TInit, T, TArgs, TSingletons, N, TArg, 0, size<TSingletons>::value>::apply(dependencies);
+  }
+};
+
+template <class TInit, class T, class TArgs, class TSingletons, int N, class TArg>
+struct parameter_dependencies<TInit, T, TArgs, TSingletons, N, TArg, false> {
+  static void apply(std::vector<int>& dependencies) {
+    constexpr auto index = index_of<di::aux::decay_t<typename unnamed<TArg>::type>>(TSingletons{});
+    if (index >= 0 && std::is_same<typename unnamed<TArg>::type, TArg>::value) {
+      dependencies.push_back(index);
+    }
+  }
+};
+
+template <class TSingletons, class T, class TInit, class... TArgs, std::size_t... Ns>
+void ctor_dependencies(std::vector<int>& dependencies,
+                       const di::aux::pair<T, di::aux::pair<TInit, di::aux::type_list<TArgs...>>>&,
+                       const std::index_sequence<Ns...>&) {
+  [](...) {}((parameter_dependencies<TInit, T, di::aux::type_list<TArgs...>, TSingletons, Ns, TArgs>::apply(dependencies),
+              0)...);
+}
+
+template <class TSingletons, class T, class TInit, class... TArgs>
+std::vector<int> dependencies(const di::aux::pair<T, di::aux::pair<TInit, di::aux::type_list<TArgs...>>>& ctor) {
+  std::vector<int> dependencies;
+  ctor_dependencies<TSingletons>(dependencies, ctor, std::index_sequence_for<TArgs...>{});
+  std::sort(dependencies.begin(), dependencies.end());
+  dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+  return dependencies;
+}
+
+/*<<work-stealing pool executing singletons in dependency order>>*/
+class scheduler {
+  struct node {
+    void (*create)(const void*);
+    const char* name;
+    std::vector<int> dependents;
+    std::atomic<int> pending{0};
+  };
+
+  struct worker {
+    std::mutex mutex;
+    std::deque<int> tasks;
+  };
+
+ public:
+  struct timing {
+    const char* name;
+    std::chrono::nanoseconds start;
+    std::chrono::nanoseconds duration;
+    std::size_t worker;
+  };
+
+  template <class TInjector, class... TDeps>
+  scheduler(const TInjector&, const di::aux::type_list<TDeps...>&)
+      : nodes_(sizeof...(TDeps)), timings_(sizeof...(TDeps)) {
+    using singletons_t = di::aux::type_list<TDeps...>;
+    const std::vector<int> dependencies[] = {
+        {}, eager::dependencies<singletons_t>(di::type_traits::ctor_traits__<typename TDeps::given>{})...};
+    const std::pair<void (*)(const void*), const char*> creates[] = {
+        {nullptr, nullptr}, {&create<TInjector, typename TDeps::expected>, typeid(typename TDeps::expected).name()}...};
+
+    for (auto i = 0u; i < nodes_.size(); ++i) {
+      std::tie(nodes_[i].create, nodes_[i].name) = creates[i + 1];
+      for (auto dependency : dependencies[i + 1]) {
+        nodes_[dependency].dependents.push_back(i);
+        ++nodes_[i].pending;
+      }
+    }
+    break_cycles();
+  }
+
+  std::vector<timing> run(const void* injector, std::size_t threads) {
+    threads = std::max<std::size_t>(1, std::min(threads, nodes_.size()));
+    std::vector<worker> workers(threads);
+    remaining_ = nodes_.size();
+    for (auto i = 0u; i < nodes_.size(); ++i) {
+      if (!nodes_[i].pending) {
+        workers[i % threads].tasks.push_back(i);
+        ++queued_;
+      }
+    }
+
+    start_ = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (auto i = 1u; i < threads; ++i) {
+      pool.emplace_back([&, i] { work(injector, workers, i); });
+    }
+    work(injector, workers, 0);
+    for (auto& thread : pool) {
+      thread.join();
+    }
+    return timings_;
+  }
+
+ private:
+  template <class TInjector, class T>
+  static void create(const void* injector) {
+    static_cast<const TInjector*>(injector)->template create<T&>();
+  }
+
+  void break_cycles() {
+    std::vector<int> pending(nodes_.size());
+    std::vector<int> ready;
+    for (auto i = 0u; i < nodes_.size(); ++i) {
+      if (!(pending[i] = nodes_[i].pending)) {
+        ready.push_back(i);
+      }
+    }
+    while (!ready.empty()) {
+      auto i = ready.back();
+      ready.pop_back();
+      for (auto dependent : nodes_[i].dependents) {
+        if (!--pending[dependent]) {
+          ready.push_back(dependent);
+        }
+      }
+    }
+    /*<<singletons in a cycle (ex. detected from overloaded constructors) are created on demand instead>>*/
+    for (auto i = 0u; i < nodes_.size(); ++i) {
+      if (pending[i]) {
+        nodes_[i].pending = 0;
+      }
+      auto& dependents = nodes_[i].dependents;
+      dependents.erase(std::remove_if(dependents.begin(), dependents.end(), [&](int dependent) { return pending[dependent]; }),
+                       dependents.end());
+    }
+  }
+
+  bool pop(std::vector<worker>& workers, std::size_t self, int& task) {
+    for (auto i = 0u; i < workers.size(); ++i) {
+      auto& worker = workers[(self + i) % workers.size()];
+      std::lock_guard<std::mutex> lock{worker.mutex};
+      if (!worker.tasks.empty()) {
+        /*<<own tasks are taken LIFO (cache locality), stolen ones FIFO>>*/
+        if (i) {
+          task = worker.tasks.front();
+          worker.tasks.pop_front();
+        } else {
+          task = worker.tasks.back();
+          worker.tasks.pop_back();
+        }
+        --queued_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void push(std::vector<worker>& workers, std::size_t self, int task) {
+    {
+      std::lock_guard<std::mutex> lock{workers[self].mutex};
+      workers[self].tasks.push_back(task);
+    }
+    ++queued_;
+    std::lock_guard<std::mutex> lock{mutex_};
+    cv_.notify_one();
+  }
+
+  void work(const void* injector, std::vector<worker>& workers, std::size_t self) {
+    for (;;) {
+      auto task = 0;
+      if (pop(workers, self, task)) {
+        execute(injector, workers, self, task);
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock{mutex_};
+      if (!remaining_) {
+        return;
+      }
+      cv_.wait(lock, [this] { return !remaining_ || queued_; });
+    }
+  }
+
+  void execute(const void* injector, std::vector<worker>& workers, std::size_t self, int task) {
+    auto& node = nodes_[task];
+    const auto start = std::chrono::steady_clock::now();
+    node.create(injector);
+    const auto end = std::chrono::steady_clock::now();
+    timings_[task] = {node.name, start - start_, end - start, self};
+
+    for (auto dependent : node.dependents) {
+      if (!--nodes_[dependent].pending) {
+        push(workers, self, dependent);
+      }
+    }
+
+    if (!--remaining_) {
+      std::lock_guard<std::mutex> lock{mutex_};
+      cv_.notify_all();
+    }
+  }
+
+  std::vector<node> nodes_;
+  std::vector<timing> timings_;
+  std::atomic<std::size_t> remaining_{0};
+  std::atomic<std::size_t> queued_{0};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // eager
+
+/*<<creates all singletons bound to the injector using `threads` and returns how long each one took>>*/
+template <class TInjector>
+auto eager_singletons(const TInjector& injector, std::size_t threads = std::thread::hardware_concurrency()) {
+  eager::scheduler scheduler{injector, typename eager::singletons<typename TInjector::deps>::type{}};
+  return scheduler.run(&injector, threads);
+}
+
+//<-
+std::mutex mutex;
+std::vector<const char*> created;
+
+void construct(const char* name, int ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  std::lock_guard<std::mutex> lock{mutex};
+  created.push_back(name);
+}
+
+struct config {
+  config() { construct("config", 0); }
+};
+
+struct connection_pool {
+  explicit connection_pool(std::shared_ptr<config>) { construct("connection_pool", 50); }
+};
+
+struct icache {
+  virtual ~icache() noexcept = default;
+};
+struct cache : icache {
+  explicit cache(const config&) { construct("cache", 50); }
+};
+
+struct regex_table {
+  BOOST_DI_INJECT(explicit regex_table, std::shared_ptr<config>) { construct("regex_table", 50); }
+};
+
+struct service {
+  service(std::shared_ptr<connection_pool>, icache&, int, std::shared_ptr<regex_table>) { construct("service", 10); }
+};
+//->
+
+int main() {
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<service>().in(di::singleton)
+  , di::bind<connection_pool>().in(di::singleton)
+  , di::bind<icache>().to<cache>().in(di::singleton)
+  , di::bind<regex_table>().in(di::singleton)
+  , di::bind<config>().in(di::singleton)
+  , di::bind<int>().to(42)
+  );
+  // clang-format on
+
+  /*<<create singletons using 4 threads, `config` first, `service` last, the rest in parallel>>*/
+  const auto timings = eager_singletons(injector, 4);
+  assert(5 == timings.size());
+  assert(5 == created.size());
+  assert(std::string{"config"} == created.front());
+  assert(std::string{"service"} == created.back());
+
+  for (const auto& timing : timings) {
+    std::printf("%-32s start: %8.3fms duration: %8.3fms worker: %zu\n", timing.name, timing.start.count() / 1e6,
+                timing.duration.count() / 1e6, timing.worker);
+  }
+
+  /*<<already created>>*/
+  injector.create<service&>();
+  assert(5 == created.size());
+}
@@ -0,0 +1,314 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//<-
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+//->
+#include <boost/di.hpp>
+
+namespace di = boost::di;
+
+/*<<owns the memory of request scoped objects, kept between requests>>*/
+class request_context {
+  struct chunk {
+    chunk* next;
+    std::size_t size;
+  };
+
+  struct destructor {
+    destructor* next;
+    void (*destroy)(destructor*);
+  };
+
+  template <class T>
+  struct holder : destructor {
+    template <class... TArgs>
+    explicit holder(destructor* next, TArgs&&... args) : destructor{next, &destroy_}, object(static_cast<TArgs&&>(args)...) {}
+    static void destroy_(destructor* self) noexcept { static_cast<holder*>(self)->~holder(); }
+    T object;
+  };
+
+  struct entry {
+    const void* key;
+    std::size_t request;
+    void* object;
+  };
+
+  class request_guard {
+   public:
+    explicit request_guard(request_context& context) noexcept : context_(&context), previous_(current()) {
+      current() = &context;
+    }
+    request_guard(request_guard&& other) noexcept : context_(other.context_), previous_(other.previous_) {
+      other.context_ = nullptr;
+    }
+    ~request_guard() noexcept {
+      if (context_) {
+        context_->end();
+        current() = previous_;
+      }
+    }
+
+   private:
+    request_context* context_ = nullptr;
+    request_context* previous_ = nullptr;
+  };
+
+ public:
+  explicit request_context(std::size_t size = 16 * 1024) : entries_(64) { grow(size); }
+  request_context(const request_context&) = delete;
+  request_context& operator=(const request_context&) = delete;
+  ~request_context() noexcept {
+    end();
+    release(chunks_);
+  }
+
+  /*<<makes `this` the current request of the calling thread, everything created is destroyed when the guard goes out of scope>>*/
+  auto begin() noexcept { return request_guard{*this}; }
+
+  static request_context*& current() noexcept {
+    static thread_local request_context* context = nullptr;
+    return context;
+  }
+
+  template <class T, class TProvider>
+  T& get(const void* key, const TProvider& provider) {
+    const auto& entry = find(key);
+    if (entry.request == request_) {
+      return *static_cast<T*>(entry.object);
+    }
+    /*<<might create nested request scoped objects, which insert entries and rehash, hence the lookup is repeated>>*/
+    auto& object = construct<T>(provider);
+    find(key) = {key, request_, &object};
+    if (++size_ * 2 > entries_.size()) {
+      rehash();
+    }
+    return object;
+  }
+
+  std::size_t capacity() const noexcept {
+    auto size = std::size_t{};
+    for (auto chunk = chunks_; chunk; chunk = chunk->next) {
+      size += chunk->size;
+    }
+    return size;
+  }
+
+ private:
+  template <class T, class TProvider>
+  T& construct(const TProvider& provider) {
+    auto memory = allocate(sizeof(holder<T>), alignof(holder<T>));
+    auto object = new (memory) holder<T>{destructors_, provider.get(di::type_traits::stack{})};
+    if (!std::is_trivially_destructible<T>::value) {
+      destructors_ = object;
+    }
+    return object->object;
+  }
+
+  void* allocate(std::size_t size, std::size_t alignment) {
+    auto padding = (alignment - reinterpret_cast<std::size_t>(current_) % alignment) % alignment;
+    if (padding + size > static_cast<std::size_t>(end_ - current_)) {
+      grow(2 * (size + alignment + chunks_->size));
+      padding = (alignment - reinterpret_cast<std::size_t>(current_) % alignment) % alignment;
+    }
+    auto ptr = current_ + padding;
+    current_ = ptr + size;
+    return ptr;
+  }
+
+  void grow(std::size_t size) {
+    auto memory = static_cast<chunk*>(::operator new(sizeof(chunk) + size));
+    chunks_ = new (memory) chunk{chunks_, size};
+    current_ = reinterpret_cast<char*>(chunks_ + 1);
+    end_ = current_ + size;
+  }
+
+  static void release(chunk* chunks) noexcept {
+    while (chunks) {
+      auto next = chunks->next;
+      ::operator delete(chunks);
+      chunks = next;
+    }
+  }
+
+  /*<<destroys request scoped objects in reverse order of creation and rewinds the arena>>*/
+  void end() noexcept {
+    while (destructors_) {
+      auto next = destructors_->next;
+      destructors_->destroy(destructors_);
+      destructors_ = next;
+    }
+    if (chunks_->next) {
+      /*<<merge chunks, so that the next request of the same size fits into a single one>>*/
+      const auto size = capacity();
+      release(chunks_);
+      chunks_ = nullptr;
+      grow(size);
+    }
+    current_ = reinterpret_cast<char*>(chunks_ + 1);
+    ++request_;
+    size_ = 0;
+  }
+
+  entry& find(const void* key) noexcept {
+    const auto mask = entries_.size() - 1;
+    for (auto i = (reinterpret_cast<std::size_t>(key) >> 4) & mask;; i = (i + 1) & mask) {
+      auto& entry = entries_[i];
+      if (entry.request != request_ || entry.key == key) {
+        return entry;
+      }
+    }
+  }
+
+  void rehash() {
+    std::vector<entry> entries(entries_.size() * 2);
+    entries.swap(entries_);
+    for (const auto& entry : entries) {
+      if (entry.request == request_) {
+        find(entry.key) = entry;
+      }
+    }
+  }
+
+  chunk* chunks_ = nullptr;
+  char* current_ = nullptr;
+  char* end_ = nullptr;
+  destructor* destructors_ = nullptr;
+  std::vector<entry> entries_;
+  std::size_t size_ = 0;
+  std::size_t request_ = 1;
+};
+
+class request_scope {
+ public:
+  template <class, class T>
+  class scope {
+   public:
+    template <class T_>
+    using is_referable = typename di::wrappers::shared<request_scope, T&>::template is_referable<T_>;
+
+    template <class, class, class TProvider>
+    static decltype(di::wrappers::shared<request_scope, T&>{di::aux::declval<TProvider>().get(di::type_traits::stack{})})
+    try_create(const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      assert(request_context::current() && "request scoped objects might be created only within a request");
+      return di::wrappers::shared<request_scope, T&>{request_context::current()->template get<T>(this, provider)};
+    }
+  };
+};
+
+static constexpr request_scope request{};
+
+//<-
+std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+  ++allocations;
+  if (auto ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  std::abort();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+struct interface1 {
+  virtual ~interface1() noexcept = default;
+  virtual void dummy() = 0;
+};
+struct implementation1 : interface1 {
+  static auto& ctor_calls() {
+    static auto calls = 0;
+    return calls;
+  }
+  static auto& instances() {
+    static auto instances = 0;
+    return instances;
+  }
+  implementation1() {
+    ctor_calls()++;
+    instances()++;
+  }
+  implementation1(implementation1&&) { instances()++; }
+  ~implementation1() noexcept { instances()--; }
+  void dummy() override {}
+};
+
+struct session {
+  int id = 0;
+};
+
+struct service {
+  explicit service(session& s) : s(s) {}
+  session& s;
+};
+
+struct handler {
+  handler(interface1& object, session& s) : object(object), s(s) {}
+  interface1& object;
+  session& s;
+};
+//->
+
+int main() {
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<interface1>().to<implementation1>().in(request)
+  , di::bind<session>().in(request)
+  , di::bind<service>().in(request)
+  );
+  // clang-format on
+
+  /*<<memory is allocated once and reused by all requests>>*/
+  request_context context;
+
+  for (auto i = 0; i < 3; ++i) {
+    const auto allocations_ = allocations;
+    {
+      auto r = context.begin();
+      /*<<shared within the request>>*/
+      auto h1 = injector.create<handler>();
+      auto h2 = injector.create<handler>();
+      assert(&h1.object == &h2.object);
+      assert(&h1.s == &h2.s);
+      assert(&h1.object == &injector.create<interface1&>());
+      assert(&h1.s == &injector.create<session&>());
+      assert(i + 1 == implementation1::ctor_calls());
+      assert(1 == implementation1::instances());
+    }  // end of request, objects are destroyed and memory is reused
+    assert(0 == implementation1::instances());
+    assert(allocations_ == allocations);
+  }
+
+  {
+    /*<<a new request creates new objects>>*/
+    auto r = context.begin();
+    injector.create<session&>().id = 42;
+    assert(42 == injector.create<session&>().id);
+  }
+
+  {
+    auto r = context.begin();
+    assert(0 == injector.create<session&>().id);
+  }
+
+  {
+    /*<<request scoped dependencies of request scoped objects are shared as well>>*/
+    auto r = context.begin();
+    auto& s = injector.create<service&>();
+    assert(&s.s == &injector.create<session&>());
+    assert(&s == &injector.create<service&>());
+  }
+}
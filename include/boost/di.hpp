@@ -76,12 +76,16 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 namespace std {
 #endif
 template <class>
+class allocator;
+template <class>
 class shared_ptr;
 template <class>
 class weak_ptr;
 template <class, class>
 class unique_ptr;
 template <class>
+struct default_delete;
+template <class>
 struct char_traits;
 template <class...>
 class tuple;
@@ -103,6 +107,8 @@ class initializer_list;
 namespace boost {
 template <class>
 class shared_ptr;
+template <class>
+class intrusive_ptr;
 }
 BOOST_DI_NAMESPACE_BEGIN
 struct _ {
@@ -152,26 +158,6 @@ template <class... Ts>
 struct inherit : Ts... {
   using type = inherit;
 };
-template <class...>
-struct join;
-template <>
-struct join<> {
-  using type = type_list<>;
-};
-template <class... TArgs>
-struct join<type_list<TArgs...>> {
-  using type = type_list<TArgs...>;
-};
-template <class... TArgs1, class... TArgs2>
-struct join<type_list<TArgs1...>, type_list<TArgs2...>> {
-  using type = type_list<TArgs1..., TArgs2...>;
-};
-template <class... TArgs1, class... TArgs2, class... Ts>
-struct join<type_list<TArgs1...>, type_list<TArgs2...>, Ts...> {
-  using type = typename join<type_list<TArgs1..., TArgs2...>, Ts...>::type;
-};
-template <class... TArgs>
-using join_t = typename join<TArgs...>::type;
 template <int...>
 struct index_sequence {
   using type = index_sequence;
@@ -187,34 +173,81 @@ template <int N>
 struct make_index_sequence_impl {
   using type = typename __make_integer_seq<integer_sequence, int, N>::type;
 };
+#elif __has_builtin(__integer_pack) || (__GNUC__ >= 8)
+template <int N>
+struct make_index_sequence_impl {
+  using type = index_sequence<__integer_pack(N)...>;
+};
 #else
-template <int>
-struct make_index_sequence_impl;
+template <class, class>
+struct concat_index_sequence;
+template <int... Ns, int... Ms>
+struct concat_index_sequence<index_sequence<Ns...>, index_sequence<Ms...>>
+    : index_sequence<Ns..., (sizeof...(Ns) + Ms)...> {};
+template <int N>
+struct make_index_sequence_impl
+    : concat_index_sequence<typename make_index_sequence_impl<N / 2>::type,
+                            typename make_index_sequence_impl<N - N / 2>::type> {};
 template <>
 struct make_index_sequence_impl<0> : index_sequence<> {};
 template <>
 struct make_index_sequence_impl<1> : index_sequence<0> {};
-template <>
-struct make_index_sequence_impl<2> : index_sequence<0, 1> {};
-template <>
-struct make_index_sequence_impl<3> : index_sequence<0, 1, 2> {};
-template <>
-struct make_index_sequence_impl<4> : index_sequence<0, 1, 2, 3> {};
-template <>
-struct make_index_sequence_impl<5> : index_sequence<0, 1, 2, 3, 4> {};
-template <>
-struct make_index_sequence_impl<6> : index_sequence<0, 1, 2, 3, 4, 5> {};
-template <>
-struct make_index_sequence_impl<7> : index_sequence<0, 1, 2, 3, 4, 5, 6> {};
-template <>
-struct make_index_sequence_impl<8> : index_sequence<0, 1, 2, 3, 4, 5, 6, 7> {};
-template <>
-struct make_index_sequence_impl<9> : index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8> {};
-template <>
-struct make_index_sequence_impl<10> : index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8, 9> {};
 #endif
 template <int N>
 using make_index_sequence = typename make_index_sequence_impl<N>::type;
+template <class...>
+struct join;
+template <>
+struct join<> {
+  using type = type_list<>;
+};
+template <class... TArgs>
+struct join<type_list<TArgs...>> {
+  using type = type_list<TArgs...>;
+};
+template <class... TArgs1, class... TArgs2>
+struct join<type_list<TArgs1...>, type_list<TArgs2...>> {
+  using type = type_list<TArgs1..., TArgs2...>;
+};
+template <int, class T>
+struct join_as {
+  using type = T;
+};
+template <class>
+struct join_shift;
+template <int... Ns>
+struct join_shift<index_sequence<Ns...>> {
+  template <class... Ts>
+  static type_list<Ts...> drop(typename join_as<Ns, const void*>::type..., Ts*...);
+  template <class... Ts>
+  using type = decltype(drop(static_cast<Ts*>(nullptr)..., static_cast<typename join_as<Ns, type_list<>>::type*>(nullptr)...));
+};
+template <bool, class, class>
+struct join_pair {
+  using type = type_list<>;
+};
+template <class T1, class T2>
+struct join_pair<true, T1, T2> : join<T1, T2> {};
+template <bool, int, class...>
+struct join_tree;
+template <int Step, class T, class... Ts>
+struct join_tree<false, Step, T, Ts...> {
+  using type = T;
+};
+template <int, class, class, class>
+struct join_step;
+template <int Step, class... Ts>
+struct join_tree<true, Step, Ts...>
+    : join_step<Step, make_index_sequence<sizeof...(Ts)>, type_list<Ts...>,
+                typename join_shift<make_index_sequence<Step>>::template type<Ts...>> {};
+template <int Step, int... Ns, class... Ts, class... TShifted>
+struct join_step<Step, index_sequence<Ns...>, type_list<Ts...>, type_list<TShifted...>>
+    : join_tree<(2 * Step < sizeof...(Ts)), 2 * Step, typename join_pair<Ns % (2 * Step) == 0, Ts, TShifted>::type...> {};
+template <class... TArgs1, class... TArgs2, class... TArgs3, class... Ts>
+struct join<type_list<TArgs1...>, type_list<TArgs2...>, type_list<TArgs3...>, Ts...>
+    : join_tree<true, 1, type_list<TArgs1...>, type_list<TArgs2...>, type_list<TArgs3...>, Ts...> {};
+template <class... TArgs>
+using join_t = typename join<TArgs...>::type;
 }
 template <class, class = void>
 struct named {};
@@ -225,6 +258,16 @@ template <class, class = int>
 struct ctor_traits;
 template <class>
 struct self {};
+template <class, decltype(sizeof(0))>
+class poly;
+template <class>
+class borrowed;
+template <class>
+struct smart_ptr_traits {};
+template <class T>
+struct smart_ptr_traits<boost::intrusive_ptr<T>> {
+  using element_type = T;
+};
 struct ignore_policies {};
 namespace core {
 template <class>
@@ -251,8 +294,11 @@ struct injector__ : T {
 #if defined(__MSVC__)
   template <class... Ts>
   using is_creatable = typename T::template is_creatable<Ts...>;
+  template <class TParent>
+  using context_t = typename T::template context_t<TParent>;
 #else
   using T::is_creatable;
+  using T::context_t;
 #endif
 };
 template <class, class...>
@@ -271,7 +317,7 @@ class unique;
 #define BOOST_DI_REQUIRES_MSG(...) typename ::boost::di::v1_0_1::aux::concept_check<__VA_ARGS__>::type
 namespace aux {
 template <class T>
-T&& declval();
+T&& declval() noexcept;
 template <class T, T V>
 struct integral_constant {
   using type = integral_constant;
@@ -329,7 +375,7 @@ struct remove_pointer<T*> {
 };
 template <class T>
 using remove_pointer_t = typename remove_pointer<T>::type;
-template <class T>
+template <class T, class = int>
 struct remove_smart_ptr {
   using type = T;
 };
@@ -350,6 +396,10 @@ struct remove_smart_ptr<boost::shared_ptr<T>> {
   using type = T;
 };
 template <class T>
+struct remove_smart_ptr<T, valid_t<typename smart_ptr_traits<T>::element_type>> {
+  using type = typename smart_ptr_traits<T>::element_type;
+};
+template <class T>
 using remove_smart_ptr_t = typename remove_smart_ptr<T>::type;
 template <class T>
 struct remove_qualifiers {
@@ -403,7 +453,7 @@ struct remove_extent<T[]> {
 };
 template <class T>
 using remove_extent_t = typename remove_extent<T>::type;
-template <class T>
+template <class T, class = int>
 struct deref_type {
   using type = T;
 };
@@ -423,6 +473,18 @@ template <class T>
 struct deref_type<std::weak_ptr<T>> {
   using type = remove_qualifiers_t<typename deref_type<T>::type>;
 };
+template <class T, decltype(sizeof(0)) N>
+struct deref_type<poly<T, N>> {
+  using type = remove_qualifiers_t<typename deref_type<T>::type>;
+};
+template <class T>
+struct deref_type<borrowed<T>> {
+  using type = remove_qualifiers_t<typename deref_type<T>::type>;
+};
+template <class T>
+struct deref_type<T, valid_t<typename smart_ptr_traits<T>::element_type>> {
+  using type = remove_qualifiers_t<typename deref_type<typename smart_ptr_traits<T>::element_type>::type>;
+};
 template <class T, class TAllocator>
 struct deref_type<std::vector<T, TAllocator>> {
   using type = core::array<remove_qualifiers_t<typename deref_type<T>::type>>;
@@ -445,9 +507,21 @@ template <class T>
 struct is_abstract : integral_constant<bool, __is_abstract(T)> {};
 template <class T>
 struct is_polymorphic : integral_constant<bool, __is_polymorphic(T)> {};
+template <class T>
+struct is_empty : integral_constant<bool, __is_empty(T)> {};
+template <class T>
+struct is_final : integral_constant<bool, __is_final(T)> {};
 template <class...>
 using is_valid_expr = true_type;
-#if __has_extension(is_constructible) && !((__clang_major__ == 3) && (__clang_minor__ == 5))
+#if __has_builtin(__is_aggregate) || (defined(__GCC__) && (__GNUC__ >= 7))
+template <class T>
+struct is_aggregate : integral_constant<bool, __is_aggregate(T)> {};
+#else
+template <class>
+struct is_aggregate : false_type {};
+#endif
+#if (__has_extension(is_constructible) && !((__clang_major__ == 3) && (__clang_minor__ == 5))) || \
+    (defined(__GCC__) && __has_builtin(__is_constructible))
 template <class T, class... TArgs>
 using is_constructible = integral_constant<bool, __is_constructible(T, TArgs...)>;
 #else
@@ -468,15 +542,26 @@ template <class T, class... TArgs>
 using is_braces_constructible = decltype(test_is_braces_constructible<T, TArgs...>(0));
 template <class T, class... TArgs>
 using is_braces_constructible_t = typename is_braces_constructible<T, TArgs...>::type;
+template <class T>
+decltype(void(T(declval<T>())), integral_constant<bool, noexcept(T(declval<T>()))>{}) test_is_nothrow_move_constructible(
+    int);
+template <class>
+false_type test_is_nothrow_move_constructible(...);
+template <class T>
+using is_nothrow_move_constructible = decltype(test_is_nothrow_move_constructible<T>(0));
 #if defined(__MSVC__)
 template <class T>
 struct is_copy_constructible : integral_constant<bool, __is_constructible(T, const T&)> {};
 template <class T>
+struct is_move_constructible : integral_constant<bool, __is_constructible(T, T&&)> {};
+template <class T>
 struct is_default_constructible : integral_constant<bool, __is_constructible(T)> {};
 #else
 template <class T>
 using is_copy_constructible = is_constructible<T, const T&>;
 template <class T>
+using is_move_constructible = is_constructible<T, T&&>;
+template <class T>
 using is_default_constructible = is_constructible<T>;
 #endif
 #if defined(__CLANG__) || defined(__MSVC__)
@@ -512,8 +597,6 @@ template <class T, class U>
 false_type is_a_impl(...);
 template <class T, class U>
 struct is_a : decltype(is_a_impl<T, U>(0)) {};
-template <class, class...>
-struct is_unique_impl;
 template <class...>
 struct not_unique : false_type {
   using type = not_unique;
@@ -522,13 +605,27 @@ template <>
 struct not_unique<> : true_type {
   using type = not_unique;
 };
-template <class T>
-struct is_unique_impl<T> : not_unique<> {};
-template <class T1, class T2, class... Ts>
-struct is_unique_impl<T1, T2, Ts...>
-    : conditional_t<is_base_of<type<T2>, T1>::value, not_unique<T2>, is_unique_impl<inherit<T1, type<T2>>, Ts...>> {};
+template <int, class T>
+struct unique_entry : type<T> {};
+template <class, class...>
+struct unique_set;
+template <int... Ns, class... Ts>
+struct unique_set<index_sequence<Ns...>, Ts...> : unique_entry<Ns, Ts>... {};
+template <class TSet, class T>
+using is_unique_in = is_convertible<TSet*, type<T>*>;
+template <class>
+struct first_not_unique;
+template <class T, class... Ts>
+struct first_not_unique<type_list<T, Ts...>> : not_unique<T> {};
+template <class TSet, class... Ts>
+struct get_not_unique
+    : first_not_unique<join_t<conditional_t<is_unique_in<TSet, Ts>::value, type_list<>, type_list<Ts>>...>> {};
+template <class TSet, class... Ts>
+struct is_unique_impl
+    : conditional_t<is_same<bool_list<always<Ts>::value...>, bool_list<is_unique_in<TSet, Ts>::value...>>::value, not_unique<>,
+                    get_not_unique<TSet, Ts...>> {};
 template <class... Ts>
-using is_unique = is_unique_impl<none_type, Ts...>;
+using is_unique = is_unique_impl<unique_set<make_index_sequence<sizeof...(Ts)>, Ts...>, Ts...>;
 template <class, class...>
 struct unique_impl;
 template <class T1, class T2, class... Rs, class... Ts>
@@ -538,7 +635,7 @@ struct unique_impl<type<T1, Rs...>, T2, Ts...>
 template <class T1, class... Rs>
 struct unique_impl<type<T1, Rs...>> : type_list<Rs...> {};
 template <class... Ts>
-struct unique : unique_impl<type<none_type>, Ts...> {};
+struct unique : conditional_t<is_unique<Ts...>::value, type_list<Ts...>, unique_impl<type<none_type>, Ts...>> {};
 template <class T>
 struct unique<T> : type_list<T> {};
 template <class... Ts>
@@ -555,7 +652,8 @@ struct callable_base_impl {
   void operator()(...) {}
 };
 template <class T>
-struct callable_base : callable_base_impl, aux::conditional_t<aux::is_class<T>::value, T, aux::none_type> {};
+struct callable_base : callable_base_impl,
+                       aux::conditional_t<aux::is_class<T>::value && !aux::is_final<T>::value, T, aux::none_type> {};
 template <typename T>
 aux::false_type is_callable_impl(T*, aux::non_type<void (callable_base_impl::*)(...), &T::operator()>* = 0);
 aux::true_type is_callable_impl(...);
@@ -604,6 +702,8 @@ struct pool<aux::type_list<TArgs...>> : TArgs... {
 #if !defined(BOOST_DI_CFG_CTOR_LIMIT_SIZE)
 #define BOOST_DI_CFG_CTOR_LIMIT_SIZE 10
 #endif
+template <class, class = int>
+struct ctor_limit : aux::integral_constant<int, BOOST_DI_CFG_CTOR_LIMIT_SIZE> {};
 namespace type_traits {
 template <class, class = int>
 struct is_injectable : ::boost::di::v1_0_1::aux::false_type {};
@@ -637,12 +737,42 @@ struct ctor_impl<TIsConstructible, T, aux::index_sequence<Ns...>,
     : aux::conditional<TIsConstructible<T, get<core::any_type_ref_fwd<T>, Ns>...>::value,
                        aux::type_list<get<core::any_type_ref_fwd<T>, Ns>...>,
                        typename ctor_impl<TIsConstructible, T, aux::make_index_sequence<sizeof...(Ns)-1>>::type> {};
-template <template <class...> class TIsConstructible, class T>
-using ctor_impl_t = typename ctor_impl<TIsConstructible, T, aux::make_index_sequence<BOOST_DI_CFG_CTOR_LIMIT_SIZE>>::type;
+template <class T, int N>
+using ctor_any_fwd = aux::conditional_t<N == 1, core::any_type_1st_fwd<T>, core::any_type_fwd<T>>;
+template <class T, int N>
+using ctor_any_ref_fwd = aux::conditional_t<N == 1, core::any_type_1st_ref_fwd<T>, core::any_type_ref_fwd<T>>;
+template <class, class, class = int>
+struct ctor_braces;
+template <class T, int... Ns>
+struct ctor_braces<T, aux::index_sequence<Ns...>,
+                   BOOST_DI_REQUIRES(aux::is_braces_constructible<T, get<ctor_any_fwd<T, sizeof...(Ns)>, Ns>...>::value)>
+    : aux::type_list<get<ctor_any_fwd<T, sizeof...(Ns)>, Ns>...> {
+  static constexpr auto value = true;
+};
+template <class T, int... Ns>
+struct ctor_braces<T, aux::index_sequence<Ns...>,
+                   BOOST_DI_REQUIRES(!aux::is_braces_constructible<T, get<ctor_any_fwd<T, sizeof...(Ns)>, Ns>...>::value)>
+    : aux::type_list<get<ctor_any_ref_fwd<T, sizeof...(Ns)>, Ns>...> {
+  static constexpr auto value = aux::is_braces_constructible<T, get<ctor_any_ref_fwd<T, sizeof...(Ns)>, Ns>...>::value;
+};
+template <class T, int N>
+using ctor_braces_t = ctor_braces<T, aux::make_index_sequence<N>>;
+template <class T, int N, int TMax = ctor_limit<T>::value>
+struct ctor_uniform : aux::conditional_t<ctor_braces_t<T, N>::value && !ctor_braces_t<T, N + 1>::value,
+                                           ctor_braces_t<T, N>, ctor_uniform<T, N + 1, TMax>> {};
+template <class T, int TMax>
+struct ctor_uniform<T, TMax, TMax>
+    : aux::conditional_t<ctor_braces_t<T, TMax>::value, ctor_braces_t<T, TMax>, aux::type_list<>> {};
+template <class T, class = typename aux::is_aggregate<T>::type>
+struct ctor_args : ctor_impl<aux::is_constructible, T, aux::make_index_sequence<ctor_limit<T>::value>> {};
+template <class T>
+struct ctor_args<T, aux::true_type> : aux::type_list<> {};
+template <class T>
+using ctor_args_t = typename ctor_args<T>::type;
 template <class...>
 struct ctor;
 template <class T>
-struct ctor<T, aux::type_list<>> : aux::pair<uniform, ctor_impl_t<aux::is_braces_constructible, T>> {};
+struct ctor<T, aux::type_list<>> : aux::pair<uniform, typename ctor_uniform<T, 0>::type> {};
 template <class T, class... TArgs>
 struct ctor<T, aux::type_list<TArgs...>> : aux::pair<direct, aux::type_list<TArgs...>> {};
 template <class T, class = void, class = typename is_injectable<T>::type>
@@ -660,7 +790,7 @@ template <class T, class _>
 struct ctor_traits_impl<T, _, aux::false_type> : aux::pair<T, typename ctor_traits<T>::type> {};
 }
 template <class T, class>
-struct ctor_traits : type_traits::ctor<T, type_traits::ctor_impl_t<aux::is_constructible, T>> {};
+struct ctor_traits : type_traits::ctor<T, type_traits::ctor_args_t<T>> {};
 template <class T>
 struct ctor_traits<std::initializer_list<T>> {
   using boost_di_inject__ = aux::type_list<>;
@@ -781,7 +911,124 @@ template <class _, class T, class... Ts>
 struct ctor_traits__<core::array<_, Ts...>, T, aux::false_type>
     : type_traits::ctor_traits__<core::array<aux::remove_smart_ptr_t<aux::remove_qualifiers_t<T>>(), Ts...>> {};
 }
+namespace aux {
+#if defined(__MSVC__)
+extern "C" void* _InterlockedCompareExchangePointer(void* volatile*, void*, void*);
+extern "C" void* _InterlockedExchangePointer(void* volatile*, void*);
+extern "C" long _InterlockedIncrement(long volatile*);
+extern "C" long _InterlockedDecrement(long volatile*);
+#pragma intrinsic(_InterlockedCompareExchangePointer, _InterlockedExchangePointer, _InterlockedIncrement)
+#pragma intrinsic(_InterlockedDecrement)
+template <class T>
+inline T* atomic_load(T* const* ptr) noexcept {
+  return *static_cast<T* const volatile*>(ptr);
+}
+inline long atomic_load(const long* ptr) noexcept { return *static_cast<const volatile long*>(ptr); }
+template <class T>
+inline void atomic_store(T** ptr, T* value) noexcept {
+  _InterlockedExchangePointer(reinterpret_cast<void* volatile*>(ptr), value);
+}
+template <class T>
+inline bool atomic_compare_exchange(T** ptr, T* expected, T* desired) noexcept {
+  return _InterlockedCompareExchangePointer(reinterpret_cast<void* volatile*>(ptr), desired, expected) == expected;
+}
+inline long atomic_increment(long* ptr) noexcept { return _InterlockedIncrement(ptr); }
+inline long atomic_decrement(long* ptr) noexcept { return _InterlockedDecrement(ptr); }
+inline void atomic_pause() noexcept {}
+#else
+template <class T>
+inline T* atomic_load(T* const* ptr) noexcept {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+inline long atomic_load(const long* ptr) noexcept { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+template <class T>
+inline void atomic_store(T** ptr, T* value) noexcept {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+template <class T>
+inline bool atomic_compare_exchange(T** ptr, T* expected, T* desired) noexcept {
+  return __atomic_compare_exchange_n(ptr, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+inline long atomic_increment(long* ptr) noexcept { return __atomic_add_fetch(ptr, 1, __ATOMIC_ACQ_REL); }
+inline long atomic_decrement(long* ptr) noexcept { return __atomic_sub_fetch(ptr, 1, __ATOMIC_ACQ_REL); }
+inline void atomic_pause() noexcept {
+#if defined(__i386__) || defined(__x86_64__)
+  __builtin_ia32_pause();
+#endif
+}
+#endif
+#if defined(_WIN32) || defined(_WIN64)
+extern "C" __declspec(dllimport) int __stdcall SwitchToThread();
+inline void atomic_yield() noexcept { SwitchToThread(); }
+#else
+#define BOOST_DI_SYMBOL_IMPL(prefix, name) #prefix name
+#define BOOST_DI_SYMBOL(prefix, name) BOOST_DI_SYMBOL_IMPL(prefix, name)
+int sched_yield__() noexcept __asm__(BOOST_DI_SYMBOL(__USER_LABEL_PREFIX__, "sched_yield"));
+#undef BOOST_DI_SYMBOL
+#undef BOOST_DI_SYMBOL_IMPL
+inline void atomic_yield() noexcept { sched_yield__(); }
+#endif
+}
+template <class T>
+class borrowed {
+ public:
+  borrowed() noexcept = default;
+  explicit borrowed(T& object) noexcept : object_(&object) {}
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<I*, T*>::value) = 0>
+  borrowed(const borrowed<I>& other) noexcept : object_(other.get()) {}
+  T* get() const noexcept { return object_; }
+  T& operator*() const noexcept { return *object_; }
+  T* operator->() const noexcept { return object_; }
+  explicit operator bool() const noexcept { return object_; }
+
+ private:
+  T* object_ = nullptr;
+};
 namespace wrappers {
+template <class TBridged, class T>
+inline TBridged bridge(const std::shared_ptr<T>& object) noexcept {
+  struct sp_holder {
+    std::shared_ptr<T> object;
+    void operator()(...) noexcept { object.reset(); }
+  };
+  return {object.get(), sp_holder{object}};
+}
+class bridge_cache {
+  struct holder {
+    void (*destroy)(holder*);
+  };
+  template <class TBridged>
+  struct bridged : holder {
+    explicit bridged(const TBridged& object) : holder{&destroy}, object(object) {}
+    static void destroy(holder* object) noexcept { delete static_cast<bridged*>(object); }
+    TBridged object;
+  };
+
+ public:
+  bridge_cache() noexcept {}
+  bridge_cache(const bridge_cache&) noexcept {}
+  bridge_cache& operator=(const bridge_cache&) = delete;
+  ~bridge_cache() noexcept {
+    if (object_) {
+      object_->destroy(object_);
+    }
+  }
+  template <class TBridged, class T>
+  const TBridged& get(const std::shared_ptr<T>& object) const noexcept {
+    auto cached = static_cast<bridged<TBridged>*>(aux::atomic_load(&object_));
+    if (!cached) {
+      cached = new bridged<TBridged>{bridge<TBridged>(object)};
+      if (!aux::atomic_compare_exchange(&object_, static_cast<holder*>(nullptr), static_cast<holder*>(cached))) {
+        delete cached;
+        cached = static_cast<bridged<TBridged>*>(aux::atomic_load(&object_));
+      }
+    }
+    return cached->object;
+  }
+
+ private:
+  mutable holder* object_ = nullptr;
+};
 template <class TScope, class T, class TObject = std::shared_ptr<T>>
 struct shared {
   using scope = TScope;
@@ -800,19 +1047,29 @@ struct shared {
   inline operator std::shared_ptr<T>&() noexcept { return object; }
   template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
   inline operator boost::shared_ptr<I>() const noexcept {
-    struct sp_holder {
-      std::shared_ptr<T> object;
-      void operator()(...) noexcept { object.reset(); }
-    };
-    return {object.get(), sp_holder{object}};
+    if (cache) {
+      return cache->template get<boost::shared_ptr<T>>(object);
+    }
+    return bridge<boost::shared_ptr<T>>(object);
   }
   template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
   inline operator std::weak_ptr<I>() const noexcept {
     return object;
   }
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator borrowed<I>() const noexcept {
+    return borrowed<I>{*object};
+  }
+  template <class TPtr, class I = typename smart_ptr_traits<TPtr>::element_type,
+            BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value &&
+                              aux::is_constructible<TPtr, const std::shared_ptr<T>&>::value) = 0>
+  inline operator TPtr() const noexcept {
+    return TPtr{object};
+  }
   inline operator T&() noexcept { return *object; }
   inline operator const T&() const noexcept { return *object; }
   TObject object;
+  const bridge_cache* cache = nullptr;
 };
 template <class TScope, class T>
 struct shared<TScope, T&> {
@@ -827,6 +1084,10 @@ struct shared<TScope, T&> {
     return *object;
   }
   inline operator T&() const noexcept { return *object; }
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator borrowed<I>() const noexcept {
+    return borrowed<I>{*object};
+  }
   T* object = nullptr;
 };
 }
@@ -838,6 +1099,10 @@ struct unique {
   inline operator I() const noexcept {
     return object;
   }
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T, I>::value) = 0>
+  inline operator I() noexcept {
+    return static_cast<T&&>(object);
+  }
   inline operator T &&() noexcept { return static_cast<T&&>(object); }
   T object;
 };
@@ -875,8 +1140,47 @@ struct unique<TScope, T*> {
   inline operator std::unique_ptr<I, D>() const noexcept {
     return std::unique_ptr<I, D>{object};
   }
+  template <class TPtr, class I = typename smart_ptr_traits<TPtr>::element_type,
+            BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator TPtr() const noexcept {
+    return TPtr{object};
+  }
   T* object = nullptr;
 };
+template <class TScope, class T, class TDeleter>
+struct unique<TScope, std::unique_ptr<T, TDeleter>> {
+  using scope = TScope;
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T, I>::value) = 0>
+  inline operator I() const noexcept {
+    return *object;
+  }
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value &&
+                                       aux::is_same<TDeleter, std::default_delete<T>>::value) = 0>
+  inline operator aux::owner<I*>() noexcept {
+    return object.release();
+  }
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, const I*>::value &&
+                                       aux::is_same<TDeleter, std::default_delete<T>>::value) = 0>
+  inline operator aux::owner<const I*>() noexcept {
+    return object.release();
+  }
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator std::shared_ptr<I>() noexcept {
+    return {object.release(), object.get_deleter()};
+  }
+  template <class I, class D,
+            BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value && aux::is_convertible<TDeleter, D>::value) = 0>
+  inline operator std::unique_ptr<I, D>() noexcept {
+    return static_cast<std::unique_ptr<T, TDeleter>&&>(object);
+  }
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value &&
+                                       !aux::is_convertible<TDeleter, std::default_delete<I>>::value &&
+                                       aux::is_move_constructible<T>::value) = 0>
+  inline operator std::unique_ptr<I, std::default_delete<I>>() noexcept {
+    return std::unique_ptr<I, std::default_delete<I>>{new T(static_cast<T&&>(*object))};
+  }
+  std::unique_ptr<T, TDeleter> object;
+};
 }
 namespace concepts {
 template <class T>
@@ -995,7 +1299,7 @@ struct ctor_size<aux::pair<TInit, aux::type_list<TCtor...>>> : aux::integral_con
 template <class... TCtor>
 struct ctor_size<aux::type_list<TCtor...>> : aux::integral_constant<int, sizeof...(TCtor)> {};
 template <class T>
-using ctor_size_t = ctor_size<typename type_traits::ctor<T, type_traits::ctor_impl_t<aux::is_constructible, T>>::type>;
+using ctor_size_t = ctor_size<typename type_traits::ctor<T, type_traits::ctor_args_t<T>>::type>;
 template <class TInitialization, class TName, class _, class TCtor, class T = aux::decay_t<_>>
 struct creatable_error_impl
     : aux::conditional_t<
@@ -1003,7 +1307,7 @@ struct creatable_error_impl
           aux::conditional_t<aux::is_same<TName, no_name>::value, typename abstract_type<T>::is_not_bound,
                              typename abstract_type<T>::template named<TName>::is_not_bound>,
           aux::conditional_t<ctor_size_t<T>::value == ctor_size<TCtor>::value,
-                             typename type<T>::has_to_many_constructor_parameters::template max<BOOST_DI_CFG_CTOR_LIMIT_SIZE>,
+                             typename type<T>::has_to_many_constructor_parameters::template max<ctor_limit<T>::value>,
                              typename type<T>::has_ambiguous_number_of_constructor_parameters::template given<
                                  ctor_size<TCtor>::value>::template expected<ctor_size_t<T>::value>>> {};
 template <class TInit, class T, class... TArgs>
@@ -1019,6 +1323,9 @@ T creatable_error() {
   return creatable_error_impl<TInitialization, TName, T, aux::type_list<TArgs...>>{};
 }
 }
+#if !defined(BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE)
+#define BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE 64
+#endif
 namespace scopes {
 class instance;
 namespace detail {
@@ -1075,9 +1382,10 @@ class instance {
     static wrappers::shared<instance, TGiven> try_create(const TProvider&);
     template <class, class, class TProvider>
     auto create(const TProvider&) const noexcept {
-      return wrappers::shared<instance, TGiven>{object_};
+      return wrappers::shared<instance, TGiven>{object_, &cache_};
     }
     std::shared_ptr<TGiven> object_;
+    wrappers::bridge_cache cache_;
   };
   template <class TExpected, class TGiven>
   struct scope<TExpected, std::initializer_list<TGiven>> {
@@ -1161,89 +1469,158 @@ class instance {
   template <class _, class... Ts>
   class scope<_, aux::type_list<Ts...>> {
     template <class>
-    struct injector__;
+    struct vtable__;
     template <class TName, class T>
-    struct injector__<named<TName, T>> {
-      T (*f)(const injector__*) = nullptr;
-      explicit injector__(const decltype(f)& ptr) : f(ptr) {}
+    struct vtable__<named<TName, T>> {
+      using create_t = T (*)(const scope&);
+      constexpr explicit vtable__(create_t create) noexcept : create(create) {}
+      create_t create;
+    };
+    struct vtable : vtable__<Ts>... {
+      constexpr vtable(void (*move)(void*, void*), void (*dtor)(void*), typename vtable__<Ts>::create_t... create) noexcept
+          : vtable__<Ts>(create)..., move(move), dtor(dtor) {}
+      void (*move)(void*, void*);
+      void (*dtor)(void*);
     };
-    struct injector : injector__<Ts>... {
-      void (*dtor)(injector*) = nullptr;
-      ~injector() noexcept { static_cast<injector*>(this)->dtor(this); }
-      template <class TName, class T>
-      T create(const named<TName, T>&, const aux::true_type&) const noexcept {
-        return static_cast<const injector__<named<TName, T>>*>(this)->f(static_cast<const injector__<named<TName, T>>*>(this));
+    template <class TInjector>
+    struct inline_storage {
+      struct holder {
+        static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+        static void operator delete(void*, void*) noexcept {}
+        TInjector injector;
+      };
+      static const TInjector& get(const void* data) noexcept { return static_cast<const holder*>(data)->injector; }
+      static void construct(void* data, TInjector&& injector) noexcept {
+        new (data) holder{static_cast<TInjector&&>(injector)};
       }
-      template <class T>
-      T create(const named<no_name, T>&, const aux::false_type&) const noexcept {
-        return typename concepts::type<T>::is_not_exposed{};
+      static void move(void* to, void* from) noexcept {
+        construct(to, static_cast<TInjector&&>(static_cast<holder*>(from)->injector));
+        dtor(from);
       }
-      template <class TName, class T>
-      T create(const named<TName, T>&, const aux::false_type&) const noexcept {
-        return typename concepts::type<T>::template named<TName>::is_not_exposed{};
+      static void dtor(void* data) noexcept { static_cast<holder*>(data)->~holder(); }
+    };
+    template <class TInjector>
+    struct heap_storage {
+      static const TInjector& get(const void* data) noexcept { return **static_cast<TInjector* const*>(data); }
+      static void construct(void* data, TInjector&& injector) noexcept {
+        *static_cast<TInjector**>(data) = new TInjector{static_cast<TInjector&&>(injector)};
       }
+      static void move(void* to, void* from) noexcept { *static_cast<TInjector**>(to) = *static_cast<TInjector**>(from); }
+      static void dtor(void* data) noexcept { delete *static_cast<TInjector**>(data); }
     };
+    template <class>
+    struct is_stateless;
+    template <template <class...> class TList, class... TDeps>
+    struct is_stateless<TList<TDeps...>>
+        : aux::is_same<aux::bool_list<aux::always<TDeps>::value...>,
+                       aux::bool_list<aux::is_empty<typename TDeps::scope::template scope<typename TDeps::expected,
+                                                                                           typename TDeps::given>>::value...>> {};
     template <class TInjector>
-    class injector_impl : injector__<Ts>... {
-      void (*dtor)(injector_impl*) = nullptr;
-      static void dtor_impl(injector_impl* object) { object->~injector_impl(); }
-      template <class, class>
-      struct create;
-      template <class TName, class T>
-      struct create<named<TName, T>, aux::true_type> {
-        static T impl(const injector__<named<TName, T>>* object) noexcept {
-          using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
-          return static_cast<const core::injector__<TInjector>&>(static_cast<const injector_impl*>(object)->injector_)
-              .create_successful_impl(type{});
-        }
-      };
-      template <class TName, class T>
-      struct create<named<TName, T>, aux::false_type> {
-        static T impl(const injector__<named<TName, T>>* object) noexcept {
-          using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
-          return static_cast<const core::injector__<TInjector>&>(static_cast<const injector_impl*>(object)->injector_)
-              .create_impl(type{});
-        }
-      };
-      template <class T>
-      struct is_creatable : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T>::value> {};
-      template <class TName, class T>
-      struct is_creatable<named<TName, T>>
-          : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T, TName>::value> {};
-
-     public:
-      explicit injector_impl(TInjector&& injector) noexcept
-          : injector__<Ts>(&injector_impl::template create<Ts, typename is_creatable<Ts>::type>::impl)...,
-            dtor(&injector_impl::dtor_impl),
-            injector_(static_cast<TInjector&&>(injector)) {}
-
-     private:
-      TInjector injector_;
+    using storage_t =
+        aux::conditional_t<(sizeof(TInjector) <= BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE && alignof(TInjector) <= alignof(double) &&
+                            noexcept(TInjector{aux::declval<TInjector&&>()}) &&
+                            is_stateless<typename TInjector::deps>::value),
+                           inline_storage<TInjector>, heap_storage<TInjector>>;
+    static_assert(BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE >= sizeof(void*),
+                  "BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE has to fit a pointer to the heap allocated injector");
+    template <class, class, class, class>
+    struct dispatch;
+    template <class TInjector, class TStorage, class TName, class T>
+    struct dispatch<TInjector, TStorage, named<TName, T>, aux::true_type> {
+      static T impl(const scope& self) noexcept {
+        using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
+        return static_cast<const core::injector__<TInjector>&>(TStorage::get(&self.storage_)).create_successful_impl(type{});
+      }
     };
-
+    template <class TInjector, class TStorage, class TName, class T>
+    struct dispatch<TInjector, TStorage, named<TName, T>, aux::false_type> {
+      static T impl(const scope& self) noexcept {
+        using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
+        return static_cast<const core::injector__<TInjector>&>(TStorage::get(&self.storage_)).create_impl(type{});
+      }
+    };
+    template <class TInjector, class T>
+    struct is_creatable : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T>::value> {};
+    template <class TInjector, class TName, class T>
+    struct is_creatable<TInjector, named<TName, T>>
+        : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T, TName>::value> {};
+    template <class TInjector, class TStorage = storage_t<TInjector>>
+    static const vtable* vtable_impl() noexcept {
+      static constexpr vtable object{&TStorage::move, &TStorage::dtor,
+                                     &dispatch<TInjector, TStorage, Ts, typename is_creatable<TInjector, Ts>::type>::impl...};
+      return &object;
+    }
+    template <class TName, class T>
+    T create_impl(const named<TName, T>&, const aux::true_type&) const noexcept {
+      return static_cast<const vtable__<named<TName, T>>*>(vtable_)->create(*this);
+    }
+    template <class T>
+    T create_impl(const named<no_name, T>&, const aux::false_type&) const noexcept {
+      return typename concepts::type<T>::is_not_exposed{};
+    }
+    template <class TName, class T>
+    T create_impl(const named<TName, T>&, const aux::false_type&) const noexcept {
+      return typename concepts::type<T>::template named<TName>::is_not_exposed{};
+    }
    public:
     template <class>
     using is_referable = aux::true_type;
     template <class TInjector, BOOST_DI_REQUIRES(aux::is_a<core::injector_base, TInjector>::value) = 0>
-    explicit scope(TInjector&& i) noexcept : injector_((injector*) new injector_impl<TInjector>{static_cast<TInjector&&>(i)}) {}
-    scope(scope&& other) noexcept : injector_(other.injector_) { other.injector_ = nullptr; }
-    ~scope() noexcept { delete injector_; }
+    explicit scope(TInjector&& i) noexcept : vtable_(vtable_impl<TInjector>()) {
+      storage_t<TInjector>::construct(&storage_, static_cast<TInjector&&>(i));
+    }
+    scope(scope&& other) noexcept : vtable_(other.vtable_) {
+      if (vtable_) {
+        vtable_->move(&storage_, &other.storage_);
+        other.vtable_ = nullptr;
+      }
+    }
+    ~scope() noexcept {
+      if (vtable_) {
+        vtable_->dtor(&storage_);
+      }
+    }
     template <class T, class TName, class TProvider>
-    static aux::conditional_t<aux::is_base_of<injector__<named<TName, T>>, injector>::value, T, void> try_create(
-        const TProvider&);
+    static aux::conditional_t<aux::is_base_of<vtable__<named<TName, T>>, vtable>::value, T, void> try_create(const TProvider&);
     template <class T, class TName, class TProvider>
     auto create(const TProvider&) {
-      return wrapper<T>{injector_->create(named<TName, T>{}, aux::is_base_of<injector__<named<TName, T>>, injector>{})};
+      return wrapper<T>{create_impl(named<TName, T>{}, aux::is_base_of<vtable__<named<TName, T>>, vtable>{})};
     }
-
    private:
-    injector* injector_;
+    const vtable* vtable_ = nullptr;
+    alignas(double) unsigned char storage_[BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE];
   };
 };
 }
 namespace type_traits {
 struct stack {};
 struct heap {};
+struct shared : heap {};
+struct placement {
+  template <class T>
+  struct direct {
+    template <class... TArgs>
+    explicit direct(TArgs&&... args) : object(static_cast<TArgs&&>(args)...) {}
+    static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+    static void operator delete(void*, void*) noexcept {}
+    T object;
+  };
+  template <class T>
+  struct uniform {
+    template <class... TArgs>
+    explicit uniform(TArgs&&... args) : object{static_cast<TArgs&&>(args)...} {}
+    static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+    static void operator delete(void*, void*) noexcept {}
+    T object;
+  };
+  template <class T>
+  struct storage {
+    alignas(T) unsigned char data[sizeof(T)];
+  };
+  void* memory;
+};
+template <class, decltype(sizeof(0))>
+struct small_buffer {};
 template <class T, class = int>
 struct memory_traits {
   using type = stack;
@@ -1262,7 +1639,7 @@ struct memory_traits<std::unique_ptr<T, TDeleter>> {
 };
 template <class T>
 struct memory_traits<std::shared_ptr<T>> {
-  using type = heap;
+  using type = shared;
 };
 template <class T>
 struct memory_traits<boost::shared_ptr<T>> {
@@ -1272,6 +1649,14 @@ template <class T>
 struct memory_traits<std::weak_ptr<T>> {
   using type = heap;
 };
+template <class T, decltype(sizeof(0)) N>
+struct memory_traits<poly<T, N>> {
+  using type = small_buffer<T, N>;
+};
+template <class T>
+struct memory_traits<T, aux::valid_t<typename smart_ptr_traits<T>::element_type>> {
+  using type = heap;
+};
 template <class T>
 struct memory_traits<T, BOOST_DI_REQUIRES(aux::is_polymorphic<T>::value)> {
   using type = heap;
@@ -1279,6 +1664,77 @@ struct memory_traits<T, BOOST_DI_REQUIRES(aux::is_polymorphic<T>::value)> {
 template <class T>
 using memory_traits_t = typename memory_traits<T>::type;
 }
+template <class T, decltype(sizeof(0)) N>
+class poly {
+  struct storage {
+    alignas(alignof(long double)) unsigned char data[N];
+  };
+  template <class TImpl>
+  struct local {
+    static T* relocate(T* object, void* memory) noexcept {
+      auto impl = static_cast<TImpl*>(object);
+      auto result = &(new (memory) type_traits::placement::direct<TImpl>(static_cast<TImpl&&>(*impl)))->object;
+      impl->~TImpl();
+      return result;
+    }
+    static void destroy(T* object) noexcept { static_cast<TImpl*>(object)->~TImpl(); }
+  };
+  template <class TImpl>
+  struct allocated {
+    static void destroy(T* object) noexcept { delete static_cast<TImpl*>(object); }
+  };
+
+ public:
+  template <class TImpl>
+  using fits = aux::integral_constant<bool, sizeof(TImpl) <= N && alignof(TImpl) <= alignof(storage) &&
+                                                aux::is_nothrow_move_constructible<TImpl>::value>;
+  poly() noexcept = default;
+  template <class TImpl, class TCreate>
+  poly(const aux::type<TImpl>&, const TCreate& create)
+      : object_(create(static_cast<void*>(&storage_))),
+        relocate_(&local<TImpl>::relocate),
+        destroy_(&local<TImpl>::destroy) {}
+  template <class TImpl>
+  explicit poly(aux::owner<TImpl*> object) noexcept : object_(object), destroy_(&allocated<TImpl>::destroy) {}
+  template <class TScope, class TImpl, BOOST_DI_REQUIRES(aux::is_convertible<TImpl*, T*>::value) = 0>
+  poly(const wrappers::unique<TScope, TImpl*>& wrapper) noexcept : poly(static_cast<aux::owner<TImpl*>>(wrapper.object)) {}
+  poly(poly&& other) noexcept { move(other); }
+  poly& operator=(poly&& other) noexcept {
+    if (this != &other) {
+      reset();
+      move(other);
+    }
+    return *this;
+  }
+  poly(const poly&) = delete;
+  poly& operator=(const poly&) = delete;
+  ~poly() noexcept { reset(); }
+  T* get() const noexcept { return object_; }
+  T& operator*() const noexcept { return *object_; }
+  T* operator->() const noexcept { return object_; }
+  explicit operator bool() const noexcept { return object_; }
+  bool inlined() const noexcept { return relocate_; }
+
+ private:
+  void move(poly& other) noexcept {
+    object_ = other.relocate_ ? other.relocate_(other.object_, &storage_) : other.object_;
+    relocate_ = other.relocate_;
+    destroy_ = other.destroy_;
+    other.object_ = nullptr;
+    other.relocate_ = nullptr;
+    other.destroy_ = nullptr;
+  }
+  void reset() noexcept {
+    if (object_) {
+      destroy_(object_);
+      object_ = nullptr;
+    }
+  }
+  storage storage_;
+  T* object_ = nullptr;
+  T* (*relocate_)(T*, void*) = nullptr;
+  void (*destroy_)(T*) = nullptr;
+};
 namespace scopes {
 class unique {
  public:
@@ -1343,7 +1799,8 @@ class singleton {
     template <class T_, class TProvider>
     auto create_impl(const TProvider& provider) {
       static std::shared_ptr<T_> object{provider.get()};
-      return wrappers::shared<singleton, T_, std::shared_ptr<T_>&>{object};
+      static wrappers::bridge_cache cache;
+      return wrappers::shared<singleton, T_, std::shared_ptr<T_>&>{object, &cache};
     }
   };
 };
@@ -1370,6 +1827,10 @@ struct scope_traits<std::weak_ptr<T>> {
   using type = scopes::singleton;
 };
 template <class T>
+struct scope_traits<borrowed<T>> {
+  using type = scopes::singleton;
+};
+template <class T>
 using scope_traits_t = typename scope_traits<T>::type;
 }
 namespace scopes {
@@ -1487,6 +1948,13 @@ template <class T, class... TDeps>
 struct get_not_supported<T, TDeps...>
     : aux::conditional<aux::is_a<core::injector_base, T>::value || aux::is_a<core::dependency_base, T>::value,
                        typename get_not_supported<TDeps...>::type, T> {};
+#if !defined(BOOST_DI_CFG_VALIDATE_BINDINGS) || BOOST_DI_CFG_VALIDATE_BINDINGS
+template <class... Ts>
+using is_unique_bindings = aux::is_unique<Ts...>;
+#else
+template <class...>
+using is_unique_bindings = aux::not_unique<>;
+#endif
 template <class>
 struct is_unique;
 template <class T, class = int>
@@ -1495,7 +1963,7 @@ template <class T>
 struct unique_dependency<T, BOOST_DI_REQUIRES(aux::is_a<core::dependency_base, T>::value)>
     : aux::pair<aux::pair<typename T::expected, typename T::name>, typename T::priority> {};
 template <class... TDeps>
-struct is_unique<aux::type_list<TDeps...>> : aux::is_unique<typename unique_dependency<TDeps>::type...> {};
+struct is_unique<aux::type_list<TDeps...>> : is_unique_bindings<typename unique_dependency<TDeps>::type...> {};
 template <class>
 struct get_is_unique_error_impl : aux::true_type {};
 template <class T, class TName, class TPriority>
@@ -1514,7 +1982,7 @@ template <class>
 struct get_is_unique_error;
 template <class... TDeps>
 struct get_is_unique_error<aux::type_list<TDeps...>>
-    : get_is_unique_error_impl<typename aux::is_unique<typename unique_dependency<TDeps>::type...>::type> {};
+    : get_is_unique_error_impl<typename is_unique_bindings<typename unique_dependency<TDeps>::type...>::type> {};
 template <class... TDeps>
 using boundable_bindings =
     aux::conditional_t<is_supported<TDeps...>::value, typename get_is_unique_error<core::bindings_t<TDeps...>>::type,
@@ -1571,7 +2039,7 @@ auto boundable_impl(concepts::any_of<Ts...>&&, T && )
     -> get_any_of_error<decltype(boundable_impl(aux::declval<Ts>(), aux::declval<T>()))...>;
 template <class... TDeps>
 auto boundable_impl(aux::type<TDeps...> && ) ->
-    typename get_is_unique_error_impl<typename aux::is_unique<TDeps...>::type>::type;
+    typename get_is_unique_error_impl<typename is_unique_bindings<TDeps...>::type>::type;
 aux::true_type boundable_impl(...);
 template <class... Ts>
 struct boundable__ {
@@ -1583,6 +2051,12 @@ using boundable = typename boundable__<Ts...>::type;
 namespace core {
 template <class, class>
 struct dependency_concept {};
+template <class, class>
+struct contextual {};
+template <class>
+struct is_contextual : aux::false_type {};
+template <class TParent, class TName>
+struct is_contextual<contextual<TParent, TName>> : aux::true_type {};
 template <class T, class TDependency>
 struct dependency_impl : aux::pair<T, TDependency> {};
 template <class T>
@@ -1651,6 +2125,10 @@ class dependency
   auto named(const T&) noexcept {
     return dependency<TScope, TExpected, TGiven, T, TPriority>{static_cast<dependency&&>(*this)};
   }
+  template <class T, BOOST_DI_REQUIRES(!aux::is_same<T, aux::none_type>::value) = 0>
+  auto when() noexcept {
+    return dependency<TScope, TExpected, TGiven, contextual<T, TName>, TPriority>{static_cast<dependency&&>(*this)};
+  }
   template <class T, BOOST_DI_REQUIRES_MSG(concepts::scopable<T>) = 0>
   auto in(const T&) noexcept {
     return dependency<T, TExpected, TGiven, TName, TPriority>{};
@@ -1678,6 +2156,12 @@ class dependency
         dependency<scopes::instance, deduce_traits_t<TExpected, T>, typename ref_traits<T>::type, TName, TPriority>;
     return dependency{static_cast<T&&>(object)};
   }
+  template <class T, class TSelector, BOOST_DI_REQUIRES(aux::is_same<TExpected, T>::value) = 0,
+            class TCreate = typename T::template selector<TSelector>>
+  auto to(const TSelector& selector) noexcept {
+    using dependency = dependency<scopes::instance, TExpected, TCreate, TName, TPriority>;
+    return dependency{TCreate{selector}};
+  }
   template <class...>
   dependency& to(...) const noexcept;
   auto operator[](const override&) noexcept {
@@ -1737,6 +2221,8 @@ template <class... Ts>
 using callable = typename is_callable<Ts...>::type;
 }
 namespace providers {
+template <class>
+void allocate_shared() noexcept;
 class stack_over_heap {
  public:
   template <class TInitialization, class T, class... TArgs>
@@ -1752,6 +2238,41 @@ class stack_over_heap {
     return new T{static_cast<TArgs&&>(args)...};
   }
   template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::shared&, TArgs&&... args) {
+    return allocate_shared<T>(std::allocator<T>{}, static_cast<TArgs&&>(args)...);
+  }
+  template <class T>
+  auto get(const type_traits::uniform&, const type_traits::shared&) {
+    return allocate_shared<T>(std::allocator<T>{});
+  }
+  template <class T, class TArg, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::shared&, TArg&& arg, TArgs&&... args) {
+    using object_t = type_traits::placement::uniform<T>;
+    const auto object =
+        allocate_shared<object_t>(std::allocator<object_t>{}, static_cast<TArg&&>(arg), static_cast<TArgs&&>(args)...);
+    return std::shared_ptr<T>{object, &object->object};
+  }
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::direct<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::uniform<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) const {
+    return poly<I, N>{aux::type<T>{}, [&](void* memory) {
+                        return get<T>(init, type_traits::placement{memory}, static_cast<TArgs&&>(args)...);
+                      }};
+  }
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(!poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) {
+    return poly<I, N>{get<T>(init, type_traits::heap{}, static_cast<TArgs&&>(args)...)};
+  }
+  template <class T, class... TArgs>
   auto get(const type_traits::direct&, const type_traits::stack&, TArgs&&... args) const noexcept {
     return T(static_cast<TArgs&&>(args)...);
   }
@@ -1772,17 +2293,540 @@ struct config {
   static auto provider(...) noexcept { return providers::stack_over_heap{}; }
   static auto policies(...) noexcept { return make_policies(); }
 };
-namespace detail {
-template <class...>
-struct bind;
-template <class TScope>
-struct bind<int, TScope> {
-  using type = core::dependency<TScope>;
-};
-template <class TScope, class T>
-struct bind<int, TScope, T> {
-  using type = core::dependency<TScope, T>;
-};
+namespace scopes {
+class concurrent_scoped {
+  template <class TObject>
+  class storage {
+    static constexpr auto max_spins = 64;
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      TObject object;
+    };
+    struct rollback {
+      ~rollback() noexcept {
+        if (object) {
+          aux::atomic_store(object, static_cast<holder*>(nullptr));
+        }
+      }
+      holder** object;
+    };
+
+   public:
+    storage() noexcept {}
+    storage(storage&&) noexcept {}
+    storage(const storage&) = delete;
+    ~storage() noexcept {
+      if (object_ && object_ != busy()) {
+        object_->~holder();
+      }
+    }
+    template <class TProvider, class... TArgs>
+    TObject& get(const TProvider& provider, const TArgs&... args) {
+      auto object = aux::atomic_load(&object_);
+      return (object && object != busy() ? object : get_slow(provider, args...))->object;
+    }
+
+   private:
+    holder* busy() noexcept { return reinterpret_cast<holder*>(&object_); }
+    template <class TProvider, class... TArgs>
+    holder* get_slow(const TProvider& provider, const TArgs&... args) {
+      auto spins = 0;
+      for (;;) {
+        auto object = aux::atomic_load(&object_);
+        if (object && object != busy()) {
+          return object;
+        }
+        if (!object && aux::atomic_compare_exchange(&object_, object, busy())) {
+          rollback guard{&object_};
+          object = new (&storage_) holder{TObject(provider.get(args...))};
+          guard.object = nullptr;
+          aux::atomic_store(&object_, object);
+          return object;
+        }
+        if (spins < max_spins) {
+          ++spins;
+          aux::atomic_pause();
+        } else {
+          aux::atomic_yield();
+        }
+      }
+    }
+    alignas(holder) unsigned char storage_[sizeof(holder)];
+    holder* object_ = nullptr;
+  };
+
+ public:
+  template <class, class T, class = decltype(has_shared_ptr__(aux::declval<T>()))>
+  class scope {
+    using object_t =
+        aux::conditional_t<aux::conditional_t<aux::is_complete<T>::value, aux::is_abstract<T>, aux::true_type>::value,
+                           aux::none_type, T>;
+
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<concurrent_scoped, T&>::template is_referable<T_>;
+    template <class, class, class TProvider>
+    static decltype(wrappers::shared<concurrent_scoped, T&>{aux::declval<TProvider>().get(type_traits::stack{})}) try_create(
+        const TProvider&);
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<concurrent_scoped, T&>(object_.get(provider, type_traits::stack{}));
+    }
+
+   private:
+    storage<object_t> object_;
+  };
+  template <class _, class T>
+  class scope<_, T, aux::true_type> {
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<concurrent_scoped, T>::template is_referable<T_>;
+    template <class, class, class TProvider, class T_ = aux::decay_t<decltype(aux::declval<TProvider>().get())>>
+    static decltype(wrappers::shared<concurrent_scoped, T_>{std::shared_ptr<T_>{aux::declval<TProvider>().get()}})
+    try_create(const TProvider&);
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<concurrent_scoped, T, std::shared_ptr<T>&>{object_.get(provider)};
+    }
+
+   private:
+    storage<std::shared_ptr<T>> object_;
+  };
+};
+}
+namespace scopes {
+class injector_singleton {
+ public:
+  template <class, class T, class = decltype(has_shared_ptr__(aux::declval<T>()))>
+  class scope {
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      T object;
+    };
+    using holder_t =
+        aux::conditional_t<aux::conditional_t<aux::is_complete<T>::value, aux::is_abstract<T>, aux::true_type>::value,
+                           aux::none_type, holder>;
+
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<injector_singleton, T&>::template is_referable<T_>;
+    scope() noexcept {}
+    scope(scope&&) noexcept {}
+    scope(const scope&) = delete;
+    ~scope() noexcept {
+      if (object_) {
+        object_->~holder_t();
+      }
+    }
+    template <class, class, class TProvider>
+    static decltype(wrappers::shared<injector_singleton, T&>{aux::declval<TProvider>().get(type_traits::stack{})}) try_create(
+        const TProvider&);
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return create_impl(provider);
+    }
+
+   private:
+    template <class TProvider>
+    wrappers::shared<injector_singleton, T&> create_impl(const TProvider& provider) {
+      if (!object_) {
+        object_ = new (&storage_) holder_t{provider.get(type_traits::stack{})};
+      }
+      return wrappers::shared<injector_singleton, T&>(object_->object);
+    }
+    alignas(holder_t) unsigned char storage_[sizeof(holder_t)];
+    holder_t* object_ = nullptr;
+  };
+  template <class _, class T>
+  class scope<_, T, aux::true_type> {
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<injector_singleton, T>::template is_referable<T_>;
+    scope() noexcept {}
+    scope(scope&&) noexcept {}
+    scope(const scope&) = delete;
+    template <class, class, class TProvider, class T_ = aux::decay_t<decltype(aux::declval<TProvider>().get())>>
+    static decltype(wrappers::shared<injector_singleton, T_>{std::shared_ptr<T_>{aux::declval<TProvider>().get()}})
+    try_create(const TProvider&);
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return create_impl(provider);
+    }
+
+   private:
+    template <class TProvider>
+    auto create_impl(const TProvider& provider) {
+      if (!object_) {
+        object_ = std::shared_ptr<T>{provider.get()};
+      }
+      return wrappers::shared<injector_singleton, T, std::shared_ptr<T>&>{object_};
+    }
+    std::shared_ptr<T> object_;
+  };
+};
+}
+#if !defined(BOOST_DI_CFG_POOL_SIZE)
+#define BOOST_DI_CFG_POOL_SIZE 32
+#endif
+class pool_return_deleter {
+ public:
+  pool_return_deleter() noexcept = default;
+  pool_return_deleter(void (*release)(void*), void* block) noexcept : release_(release), block_(block) {}
+  template <class T>
+  void operator()(T*) const noexcept {
+    release_(block_);
+  }
+
+ private:
+  void (*release_)(void*) = nullptr;
+  void* block_ = nullptr;
+};
+struct pool_statistics {
+  unsigned long hits;
+  unsigned long misses;
+};
+namespace scopes {
+template <class T, class... TArgs>
+decltype(::boost::di::v1_0_1::aux::declval<T>().reset(::boost::di::v1_0_1::aux::declval<TArgs>()...),
+         ::boost::di::v1_0_1::aux::true_type())
+has_reset_impl(int);
+template <class, class...>
+::boost::di::v1_0_1::aux::false_type has_reset_impl(...);
+template <class T, class... TArgs>
+struct has_reset : decltype(has_reset_impl<T, TArgs...>(0)) {};
+class pooled {
+  template <class T>
+  class pool {
+    struct cache;
+    struct block {
+      alignas(T) unsigned char object[sizeof(T)];
+      block* next;
+      cache* owner;
+    };
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      T object;
+    };
+    struct cache {
+      long id;
+      cache* next;
+      cache* sibling;
+      const void* thread;
+      block* objects;
+      int size;
+      long dead;
+      long references;
+    };
+    struct caches {
+      ~caches() noexcept {
+        while (auto cache = head) {
+          head = cache->next;
+          detach(cache);
+        }
+      }
+      cache* head = nullptr;
+    };
+    static holder* object(block* object) noexcept { return reinterpret_cast<holder*>(object->object); }
+    static void recycle(block* object, const aux::true_type&) noexcept { pool::object(object)->object.reset(); }
+    static void recycle(block* object, const aux::false_type&) noexcept { pool::object(object)->~holder(); }
+    static void destroy(block* object, const aux::true_type&) noexcept { pool::object(object)->~holder(); }
+    static void destroy(block*, const aux::false_type&) noexcept {}
+    static caches& local() noexcept {
+      static thread_local caches caches_;
+      return caches_;
+    }
+    static long next_id() noexcept {
+      static long ids = 0;
+      return aux::atomic_increment(&ids);
+    }
+    static void release(cache* cache) noexcept {
+      if (!aux::atomic_decrement(&cache->references)) {
+        delete cache;
+      }
+    }
+    static void detach(cache* cache) noexcept {
+      while (auto object = cache->objects) {
+        cache->objects = object->next;
+        destroy(object, has_reset<T&>{});
+        delete object;
+      }
+      aux::atomic_increment(&cache->dead);
+      release(cache);
+    }
+    static void release(void* ptr) noexcept {
+      auto object = static_cast<block*>(ptr);
+      auto cache = object->owner;
+      if (cache->thread == &local() && !aux::atomic_load(&cache->dead) && cache->size < BOOST_DI_CFG_POOL_SIZE) {
+        recycle(object, has_reset<T&>{});
+        object->next = cache->objects;
+        cache->objects = object;
+        ++cache->size;
+      } else {
+        pool::object(object)->~holder();
+        delete object;
+      }
+      release(cache);
+    }
+    cache& local_cache() {
+      auto& caches = local();
+      for (auto cache = &caches.head; *cache;) {
+        if ((*cache)->id == id_) {
+          return **cache;
+        }
+        if (aux::atomic_load(&(*cache)->dead)) {
+          auto next = (*cache)->next;
+          detach(*cache);
+          *cache = next;
+        } else {
+          cache = &(*cache)->next;
+        }
+      }
+      caches.head = new cache{id_, caches.head, nullptr, &caches, nullptr, 0, 0, 2};
+      do {
+        caches.head->sibling = aux::atomic_load(&caches_);
+      } while (!aux::atomic_compare_exchange(&caches_, caches.head->sibling, caches.head));
+      return *caches.head;
+    }
+    long id_ = 0;
+    cache* caches_ = nullptr;
+
+   public:
+    pool() noexcept : id_(next_id()) {}
+    pool(pool&&) noexcept : id_(next_id()) {}
+    pool(const pool&) = delete;
+    ~pool() noexcept {
+      for (auto cache = aux::atomic_load(&caches_); cache;) {
+        auto sibling = cache->sibling;
+        aux::atomic_increment(&cache->dead);
+        release(cache);
+        cache = sibling;
+      }
+    }
+    static pool_statistics& statistics() noexcept {
+      static thread_local pool_statistics statistics_{};
+      return statistics_;
+    }
+    template <class TProvider>
+    std::unique_ptr<T, pool_return_deleter> get(const TProvider& provider) {
+      auto& cache = local_cache();
+      auto object = cache.objects;
+      if (object && has_reset<T&>::value) {
+        cache.objects = object->next;
+        --cache.size;
+        ++statistics().hits;
+      } else {
+        object = create(cache, provider);
+      }
+      aux::atomic_increment(&cache.references);
+      return {&pool::object(object)->object, pool_return_deleter{&release, object}};
+    }
+
+   private:
+    struct rollback {
+      ~rollback() noexcept { delete object; }
+      block* object;
+    };
+    template <class TProvider>
+    static block* create(cache& cache, const TProvider& provider) {
+      if (auto object = cache.objects) {
+        new (object->object) holder{provider.get(type_traits::stack{})};
+        cache.objects = object->next;
+        --cache.size;
+        ++statistics().hits;
+        return object;
+      }
+      rollback guard{new block};
+      new (guard.object->object) holder{provider.get(type_traits::stack{})};
+      auto object = guard.object;
+      guard.object = nullptr;
+      object->owner = &cache;
+      ++statistics().misses;
+      return object;
+    }
+  };
+
+ public:
+  template <class T>
+  static pool_statistics statistics() noexcept {
+    return pool<T>::statistics();
+  }
+  template <class, class T>
+  class scope {
+   public:
+    template <class>
+    using is_referable = aux::false_type;
+    template <class, class, class TProvider, class T_ = decltype(aux::declval<TProvider>().get(type_traits::stack{}))>
+    static wrappers::unique<pooled, std::unique_ptr<T_, pool_return_deleter>> try_create(const TProvider&);
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::unique<pooled, std::unique_ptr<T, pool_return_deleter>>{pool_.get(provider)};
+    }
+
+   private:
+    pool<T> pool_;
+  };
+};
+}
+namespace scopes {
+class thread_local_ {
+  struct node {
+    virtual ~node() noexcept = default;
+    virtual void destroy() noexcept = 0;
+    long id = 0;
+    node* next = nullptr;
+    node* sibling = nullptr;
+    long destroyed = 0;
+    long released = 0;
+  };
+  struct objects {
+    ~objects() noexcept {
+      while (auto object = head) {
+        head = object->next;
+        release(object);
+      }
+    }
+    node* head = nullptr;
+  };
+  static node*& head() noexcept {
+    static thread_local objects objects_;
+    return objects_.head;
+  }
+  static void release(node* object) noexcept {
+    if (aux::atomic_increment(&object->destroyed) == 1) {
+      object->destroy();
+    }
+    if (aux::atomic_increment(&object->released) == 2) {
+      delete object;
+    }
+  }
+  template <class TObject>
+  class storage {
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      TObject object;
+    };
+    struct holder_node : node {
+      void destroy() noexcept override { object->~holder(); }
+      holder* object = nullptr;
+      alignas(holder) unsigned char storage_[sizeof(holder)];
+    };
+    static long next_id() noexcept {
+      static long ids = 0;
+      return aux::atomic_increment(&ids);
+    }
+    struct cache {
+      long id;
+      holder_node* object;
+    };
+    static cache& last() noexcept {
+      static thread_local cache last_{0, nullptr};
+      return last_;
+    }
+
+   public:
+    storage() noexcept : id_(next_id()) {}
+    storage(storage&&) noexcept : id_(next_id()) {}
+    storage(const storage&) = delete;
+    ~storage() noexcept {
+      for (auto object = aux::atomic_load(&objects_); object;) {
+        auto sibling = object->sibling;
+        release(object);
+        object = sibling;
+      }
+    }
+    template <class TProvider, class... TArgs>
+    TObject& get(const TProvider& provider, const TArgs&... args) {
+      if (last().id == id_) {
+        return last().object->object->object;
+      }
+      for (auto object = &head(); *object;) {
+        if ((*object)->id == id_) {
+          last() = cache{id_, static_cast<holder_node*>(*object)};
+          return last().object->object->object;
+        }
+        if (aux::atomic_load(&(*object)->destroyed)) {
+          auto next = (*object)->next;
+          release(*object);
+          *object = next;
+        } else {
+          object = &(*object)->next;
+        }
+      }
+      return create(provider, args...);
+    }
+
+   private:
+    template <class TProvider, class... TArgs>
+    TObject& create(const TProvider& provider, const TArgs&... args) {
+      auto object = new holder_node{};
+      object->id = id_;
+      object->object = new (&object->storage_) holder{TObject(provider.get(args...))};
+      object->next = head();
+      head() = object;
+      last() = cache{id_, object};
+      do {
+        object->sibling = aux::atomic_load(&objects_);
+      } while (!aux::atomic_compare_exchange(&objects_, object->sibling, static_cast<node*>(object)));
+      return object->object->object;
+    }
+    long id_ = 0;
+    node* objects_ = nullptr;
+  };
+
+ public:
+  template <class, class T, class = decltype(has_shared_ptr__(aux::declval<T>()))>
+  class scope {
+    using object_t =
+        aux::conditional_t<aux::conditional_t<aux::is_complete<T>::value, aux::is_abstract<T>, aux::true_type>::value,
+                           aux::none_type, T>;
+
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<thread_local_, T&>::template is_referable<T_>;
+    template <class, class, class TProvider>
+    static decltype(wrappers::shared<thread_local_, T&>{aux::declval<TProvider>().get(type_traits::stack{})}) try_create(
+        const TProvider&);
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<thread_local_, T&>(object_.get(provider, type_traits::stack{}));
+    }
+
+   private:
+    storage<object_t> object_;
+  };
+  template <class _, class T>
+  class scope<_, T, aux::true_type> {
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<thread_local_, T>::template is_referable<T_>;
+    template <class, class, class TProvider, class T_ = aux::decay_t<decltype(aux::declval<TProvider>().get())>>
+    static decltype(wrappers::shared<thread_local_, T_>{std::shared_ptr<T_>{aux::declval<TProvider>().get()}})
+    try_create(const TProvider&);
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<thread_local_, T, std::shared_ptr<T>&>{object_.get(provider)};
+    }
+
+   private:
+    storage<std::shared_ptr<T>> object_;
+  };
+};
+}
+namespace detail {
+template <class...>
+struct bind;
+template <class TScope>
+struct bind<int, TScope> {
+  using type = core::dependency<TScope>;
+};
+template <class TScope, class T>
+struct bind<int, TScope, T> {
+  using type = core::dependency<TScope, T>;
+};
 template <class TScope, class... Ts>
 struct bind<int, TScope, Ts...> {
   using type = core::dependency<TScope, concepts::any_of<Ts...>>;
@@ -1803,6 +2847,10 @@ static constexpr BOOST_DI_UNUSED core::override override{};
 static constexpr BOOST_DI_UNUSED scopes::deduce deduce{};
 static constexpr BOOST_DI_UNUSED scopes::unique unique{};
 static constexpr BOOST_DI_UNUSED scopes::singleton singleton{};
+static constexpr BOOST_DI_UNUSED scopes::injector_singleton injector_singleton{};
+static constexpr BOOST_DI_UNUSED scopes::concurrent_scoped concurrent_scoped{};
+static constexpr BOOST_DI_UNUSED scopes::thread_local_ thread_local_{};
+static constexpr BOOST_DI_UNUSED scopes::pooled pooled{};
 namespace core {
 class binder {
   template <class TDefault, class>
@@ -1818,171 +2866,258 @@ class binder {
       aux::pair<TConcept, dependency<TScope, TExpected, TGiven, TName, override>>* dep) noexcept {
     return static_cast<dependency<TScope, TExpected, TGiven, TName, override>&>(*dep);
   }
-  template <class TDeps, class T, class TName, class TDefault>
+  template <class TDeps, class TContext>
+  using is_bound = aux::integral_constant<
+      bool, !aux::is_same<decltype(resolve_impl<aux::none_type, TContext>((TDeps*)0)), aux::none_type>::value>;
+  template <class TDefault, class TDependency, class TContext, class TDeps>
+  static decltype(auto) resolve_context(TDeps* deps, const aux::false_type&) noexcept {
+    return resolve_impl<TDefault, TDependency>(deps);
+  }
+  template <class TDefault, class TDependency, class TContext, class TDeps>
+  static decltype(auto) resolve_context(TDeps* deps, const aux::true_type&) noexcept {
+    return resolve_impl<TDefault, TContext>(deps);
+  }
+  template <class TDeps, class TContext, class TParent>
+  struct is_contextual : is_bound<TDeps, TContext> {};
+  template <class TDeps, class TContext>
+  struct is_contextual<TDeps, TContext, aux::none_type> : aux::false_type {};
+  template <class TDeps, class T, class TName, class TDefault, class TParent>
   struct resolve__ {
     using dependency = dependency_concept<aux::decay_t<T>, TName>;
-    using type = aux::remove_reference_t<decltype(resolve_impl<TDefault, dependency>((TDeps*)0))>;
+    using context = dependency_concept<aux::decay_t<T>, contextual<TParent, TName>>;
+    using type = aux::remove_reference_t<decltype(
+        resolve_context<TDefault, dependency, context>((TDeps*)0, is_bound<TDeps, context>{}))>;
+  };
+  template <class TDeps, class T, class TName, class TDefault>
+  struct resolve__<TDeps, T, TName, TDefault, aux::none_type> {
+    using type = aux::remove_reference_t<decltype(
+        resolve_impl<TDefault, dependency_concept<aux::decay_t<T>, TName>>((TDeps*)0))>;
   };
 
  public:
-  template <class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>, class TDeps>
+  template <class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>,
+            class TParent = aux::none_type, class TDeps>
   static decltype(auto) resolve(TDeps* deps) noexcept {
     using dependency = dependency_concept<aux::decay_t<T>, TName>;
-    return resolve_impl<TDefault, dependency>(deps);
+    using context = dependency_concept<aux::decay_t<T>, contextual<TParent, TName>>;
+    return resolve_context<TDefault, dependency, context>(deps, is_contextual<TDeps, context, TParent>{});
   }
-  template <class TDeps, class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>>
-  using resolve_t = typename resolve__<TDeps, T, TName, TDefault>::type;
+  template <class TDeps, class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>,
+            class TParent = aux::none_type>
+  using resolve_t = typename resolve__<TDeps, T, TName, TDefault, TParent>::type;
 };
 }
 namespace core {
-template <class T, class TInjector, class TError = aux::false_type>
+template <class T>
+class objects {
+  struct storage {
+    alignas(T) unsigned char data[sizeof(T)];
+  };
+
+ public:
+  using size_type = decltype(sizeof(0));
+  struct element {
+    static void* operator new(size_type, void* ptr) noexcept { return ptr; }
+    static void operator delete(void*, void*) noexcept {}
+    T object;
+  };
+  template <class TCreate>
+  objects(size_type size, const TCreate& create) : objects(reinterpret_cast<T*>(new storage[size])) {
+    create(static_cast<void*>(data_), size, size_);
+  }
+  objects(objects&& other) noexcept : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  objects(const objects&) = delete;
+  objects& operator=(const objects&) = delete;
+  ~objects() noexcept {
+    while (size_) {
+      data_[--size_].~T();
+    }
+    delete[] reinterpret_cast<storage*>(data_);
+  }
+  T* begin() const noexcept { return data_; }
+  T* end() const noexcept { return data_ + size_; }
+  T* data() const noexcept { return data_; }
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return !size_; }
+  T& operator[](size_type i) const noexcept { return data_[i]; }
+
+ private:
+  explicit objects(T* data) noexcept : data_(data) {}
+  T* data_ = nullptr;
+  size_type size_ = 0;
+};
+}
+namespace core {
+template <class T, class TInjector, class TParent, class TError = aux::false_type>
 struct is_referable__ {
-  static constexpr auto value = dependency__<binder::resolve_t<TInjector, T>>::template is_referable<T>::value;
+  using dependency_t = binder::resolve_t<TInjector, T, no_name, dependency<scopes::deduce, aux::decay_t<T>>, TParent>;
+  static constexpr auto value = dependency__<dependency_t>::template is_referable<T>::value;
 };
-template <class T, class TInjector>
-struct is_referable__<T, TInjector, aux::true_type> {
+template <class T, class TInjector, class TParent>
+struct is_referable__<T, TInjector, TParent, aux::true_type> {
   static constexpr auto value = true;
 };
-template <class T, class TInjector, class TError>
+template <class T, class TInjector, class TParent, class TError>
 struct is_creatable__ {
-  static constexpr auto value = injector__<TInjector>::template is_creatable<T>::value;
+  static constexpr auto value = injector__<TInjector>::template is_creatable<T, no_name, aux::false_type, TParent>::value;
 };
-template <class T, class TInjector>
-struct is_creatable__<T, TInjector, aux::false_type> {
+template <class T, class TInjector, class TParent>
+struct is_creatable__<T, TInjector, TParent, aux::false_type> {
   static constexpr auto value = true;
 };
 template <class TParent, class TInjector, class TError = aux::false_type>
 struct any_type {
-  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
 template <class TParent, class TInjector, class TError = aux::false_type, class TRefError = aux::false_type>
 struct any_type_ref {
-  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 #if defined(__GCC__)
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, TError>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, context_t, TError>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, TError>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, context_t, TError>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, TError>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, context_t, TError>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
 template <class TParent, class TInjector, class TError = aux::false_type>
 struct any_type_1st {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
 template <class TParent, class TInjector, class TError = aux::false_type, class TRefError = aux::false_type>
 struct any_type_1st_ref {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 #if defined(__GCC__)
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, context_t, TError>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, context_t, TError>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, context_t, TError>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
 namespace successful {
 template <class TParent, class TInjector>
 struct any_type {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
   template <class T>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
 template <class TParent, class TInjector>
 struct any_type_ref {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
   template <class T>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 #if defined(__GCC__)
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
 template <class TParent, class TInjector>
 struct any_type_1st {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
 template <class TParent, class TInjector>
 struct any_type_1st_ref {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 #if defined(__GCC__)
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
   const TInjector& injector_;
 };
@@ -2089,7 +3224,8 @@ struct try_provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, T
   struct is_creatable {
     static constexpr auto value =
         TProvider::template is_creatable<TInitialization, T,
-                                         typename injector__<TInjector>::template try_create<TCtor>::type...>::value;
+                                         typename injector__<TInjector>::template try_create<
+                                             TCtor, typename injector__<TInjector>::template context_t<T>>::type...>::value;
   };
   template <class TMemory = type_traits::heap>
   auto get(const TMemory& = {}) const
@@ -2102,13 +3238,15 @@ template <class T, class TName, class TInjector, class TInitialization, template
 struct provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, TName, TInjector> {
   using provider_t = decltype(TInjector::config::provider((TInjector*)0));
   using injector_t = TInjector;
+  using context_t = aux::type<typename injector__<TInjector>::template context_t<T>>;
   template <class, class... TArgs>
   struct is_creatable {
     static constexpr auto value = provider_t::template is_creatable<TInitialization, T, TArgs...>::value;
   };
   template <class TMemory = type_traits::heap>
   auto get(const TMemory& memory = {}) const {
-    return get_impl(memory, static_cast<const injector__<TInjector>*>(injector_)->create_impl(aux::type<TCtor>{})...);
+    return get_impl(memory,
+                    static_cast<const injector__<TInjector>*>(injector_)->create_impl(aux::type<TCtor>{}, context_t{})...);
   }
   template <class TMemory, class... TArgs, BOOST_DI_REQUIRES(is_creatable<TMemory, TArgs...>::value) = 0>
   auto get_impl(const TMemory& memory, TArgs&&... args) const {
@@ -2127,17 +3265,59 @@ struct provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, TName
   }
   const TInjector* injector_;
 };
+/**
+ * Provider constructs in place only when it spells out type_traits::placement,
+ * a provider accepting any memory (ex. returning `new T`) is bypassed
+ */
+template <class TProvider, class T, class TInitialization, class... TArgs>
+class is_placement_provider {
+  struct any_memory {};
+  template <class TMemory>
+  static decltype(aux::declval<TProvider>().template get<T>(TInitialization{}, aux::declval<TMemory>(),
+                                                             aux::declval<TArgs>()...),
+                  aux::true_type{})
+  test(int);
+  template <class>
+  static aux::false_type test(...);
+
+ public:
+  static constexpr auto value =
+      decltype(test<type_traits::placement>(0))::value && !decltype(test<any_memory>(0))::value;
+};
 namespace successful {
 template <class, class>
 struct provider;
 template <class T, class TInjector, class TInitialization, template <class...> class TList, class... TCtor>
 struct provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, TInjector> {
   using injector_t = TInjector;
+  using context_t = aux::type<typename injector__<TInjector>::template context_t<T>>;
   template <class TMemory = type_traits::heap>
   auto get(const TMemory& memory = {}) const {
     return TInjector::config::provider(injector_)
         .template get<T>(TInitialization{}, memory,
-                         static_cast<const injector__<TInjector>*>(injector_)->create_successful_impl(aux::type<TCtor>{})...);
+                         static_cast<const injector__<TInjector>*>(injector_)
+                             ->create_successful_impl(aux::type<TCtor>{}, context_t{})...);
+  }
+  auto get(const type_traits::placement& memory) const {
+    return get_placement(memory, static_cast<const injector__<TInjector>*>(injector_)
+                                     ->create_successful_impl(aux::type<TCtor>{}, context_t{})...);
+  }
+  template <class... TArgs>
+  auto get_placement(const type_traits::placement& memory, TArgs&&... args) const {
+    return get_placement_impl(
+        memory, aux::integral_constant<bool, is_placement_provider<decltype(TInjector::config::provider(injector_)), T,
+                                                                   TInitialization, TArgs...>::value>{},
+        static_cast<TArgs&&>(args)...);
+  }
+  template <class... TArgs>
+  auto get_placement_impl(const type_traits::placement& memory, const aux::true_type&, TArgs&&... args) const {
+    return TInjector::config::provider(injector_).template get<T>(TInitialization{}, memory, static_cast<TArgs&&>(args)...);
+  }
+  template <class... TArgs>
+  auto get_placement_impl(const type_traits::placement& memory, const aux::false_type&, TArgs&&... args) const {
+    using object_t = aux::conditional_t<aux::is_same<TInitialization, type_traits::direct>::value,
+                                        type_traits::placement::direct<T>, type_traits::placement::uniform<T>>;
+    return &(new (memory.memory) object_t(static_cast<TArgs&&>(args)...))->object;
   }
   const TInjector* injector_;
 };
@@ -2172,6 +3352,12 @@ struct from_injector {};
 struct from_deps {};
 struct init {};
 struct with_error {};
+template <class, class>
+constexpr bool is_extern_create = false;
+template <class TInjector, class T>
+struct extern_create : aux::integral_constant<bool, is_extern_create<TInjector, T>> {
+  static T create(const TInjector&);
+};
 template <class>
 struct copyable;
 template <class T>
@@ -2203,6 +3389,15 @@ struct referable<T&&, TDependency> {
 #endif
 template <class T, class TDependency>
 using referable_t = typename referable<T, TDependency>::type;
+template <class>
+struct has_contextual;
+template <class... TDeps>
+struct has_contextual<aux::type_list<TDeps...>>
+    : aux::integral_constant<bool, !aux::is_same<aux::bool_list<aux::always<TDeps>::value...>,
+                                                 aux::bool_list<!is_contextual<typename TDeps::name>::value...>>::value> {};
+template <class TDependency>
+struct is_placeable : aux::integral_constant<bool, aux::is_same<typename TDependency::scope, scopes::deduce>::value ||
+                                                       aux::is_same<typename TDependency::scope, scopes::unique>::value> {};
 #if defined(__MSVC__)
 template <class T, class TInjector>
 inline auto build(TInjector&& injector) noexcept {
@@ -2214,12 +3409,16 @@ class injector : injector_base, pool<bindings_t<TDeps...>> {
   friend class binder;
   template <class>
   friend struct pool;
+  template <class, class>
+  friend struct extern_create;
   using pool_t = pool<bindings_t<TDeps...>>;
 
  protected:
-  template <class T, class TName = no_name, class TIsRoot = aux::false_type>
+  template <class TParent>
+  using context_t = aux::conditional_t<has_contextual<bindings_t<TDeps...>>::value, TParent, aux::none_type>;
+  template <class T, class TName = no_name, class TIsRoot = aux::false_type, class TParent = aux::none_type>
   struct is_creatable {
-    using dependency_t = binder::resolve_t<injector, T, TName>;
+    using dependency_t = binder::resolve_t<injector, T, TName, dependency<scopes::deduce, aux::decay_t<T>>, TParent>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using ctor_args_t = typename ctor_t::second::second;
     static constexpr auto value =
@@ -2232,17 +3431,25 @@ class injector : injector_base, pool<bindings_t<TDeps...>> {
  public:
   using deps = bindings_t<TDeps...>;
   using config = TConfig;
+  template <class T>
+  using storage_t = type_traits::placement::storage<typename binder::resolve_t<injector, T>::given>;
   injector(injector&&) = default;
   template <class... TArgs>
   explicit injector(const init&, TArgs... args) noexcept : injector{from_deps{}, static_cast<TArgs&&>(args)...} {}
   template <class TConfig_, class TPolicies_, class... TDeps_>
   explicit injector(injector<TConfig_, TPolicies_, TDeps_...>&& other) noexcept
       : injector{from_injector{}, static_cast<injector<TConfig_, TPolicies_, TDeps_...>&&>(other), deps{}} {}
-  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  template <class T, BOOST_DI_REQUIRES(extern_create<injector, T>::value) = 0>
+  T create() const {
+    return extern_create<injector, T>::create(*this);
+  }
+  template <class T, BOOST_DI_REQUIRES(aux::conditional_t<extern_create<injector, T>::value, aux::false_type,
+                                                          is_creatable<T, no_name, aux::true_type>>::value) = 0>
   T create() const {
     return BOOST_DI_TYPE_WKND(T) create_successful_impl<aux::true_type>(aux::type<T>{});
   }
-  template <class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, aux::true_type>::value) = 0>
+  template <class T, BOOST_DI_REQUIRES(!aux::conditional_t<extern_create<injector, T>::value, aux::true_type,
+                                                           is_creatable<T, no_name, aux::true_type>>::value) = 0>
   BOOST_DI_DEPRECATED("creatable constraint not satisfied")
   T
       // clang-format off
@@ -2252,85 +3459,126 @@ class injector : injector_base, pool<bindings_t<TDeps...>> {
     return BOOST_DI_TYPE_WKND(T) create_impl<aux::true_type>(aux::type<T>{});
   }
 
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  objects<T> create_n(decltype(sizeof(0)) size) const {
+    return objects<T>{size, [this](void* memory, decltype(sizeof(0)) size, decltype(sizeof(0))& created) {
+                        create_n_impl__<T>(memory, size, created);
+                      }};
+  }
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  T* create_into(void* memory, decltype(sizeof(0)) size) const {
+    struct rollback {
+      ~rollback() noexcept {
+        while (created) {
+          static_cast<T*>(memory)[--created].~T();
+        }
+      }
+      void* memory;
+      decltype(sizeof(0)) created;
+    } guard{memory, 0};
+    create_n_impl__<T>(memory, size, guard.created);
+    guard.created = 0;
+    return &static_cast<typename objects<T>::element*>(memory)->object;
+  }
+  template <class T, BOOST_DI_REQUIRES(aux::conditional_t<is_placeable<binder::resolve_t<injector, T>>::value,
+                                                          is_creatable<T*, no_name, aux::true_type>,
+                                                          aux::false_type>::value) = 0>
+  T& create_at(void* memory) const {
+    return *create_at_impl__<T>(memory);
+  }
+
  protected:
-  template <class T>
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  T create_extern__() const {
+    return BOOST_DI_TYPE_WKND(T) create_successful_impl<aux::true_type>(aux::type<T>{});
+  }
+  template <class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, aux::true_type>::value) = 0>
+  BOOST_DI_DEPRECATED("creatable constraint not satisfied")
+  T
+      // clang-format off
+  create_extern__
+      // clang-format on
+      () const {
+    return BOOST_DI_TYPE_WKND(T) create_impl<aux::true_type>(aux::type<T>{});
+  }
+  template <class T, class TParent = aux::none_type>
   struct try_create {
-    using type = aux::conditional_t<is_creatable<T>::value, T, void>;
+    using type = aux::conditional_t<is_creatable<T, no_name, aux::false_type, TParent>::value, T, void>;
   };
-  template <class TParent>
-  struct try_create<any_type_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_fwd<TParent>, _> {
     using type = any_type<TParent, injector, with_error>;
   };
-  template <class TParent>
-  struct try_create<any_type_ref_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_ref_fwd<TParent>, _> {
     using type = any_type_ref<TParent, injector, with_error>;
   };
-  template <class TParent>
-  struct try_create<any_type_1st_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_1st_fwd<TParent>, _> {
     using type = any_type_1st<TParent, injector, with_error>;
   };
-  template <class TParent>
-  struct try_create<any_type_1st_ref_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_1st_ref_fwd<TParent>, _> {
     using type = any_type_1st_ref<TParent, injector, with_error>;
   };
-  template <class TName, class T>
-  struct try_create<::boost::di::v1_0_1::named<TName, T>> {
-    using type = aux::conditional_t<is_creatable<T, TName>::value, T, void>;
+  template <class TName, class T, class TParent>
+  struct try_create<::boost::di::v1_0_1::named<TName, T>, TParent> {
+    using type = aux::conditional_t<is_creatable<T, TName, aux::false_type, TParent>::value, T, void>;
   };
-  template <class T>
-  struct try_create<self<T>> {
+  template <class T, class _>
+  struct try_create<self<T>, _> {
     using type = injector;
   };
-  template <class TIsRoot = aux::false_type, class T>
-  auto create_impl(const aux::type<T>&) const {
-    return create_impl__<TIsRoot, T>();
+  template <class TIsRoot = aux::false_type, class T, class TParent = aux::none_type>
+  auto create_impl(const aux::type<T>&, const aux::type<TParent>& = {}) const {
+    return create_impl__<TIsRoot, T, no_name, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type_ref<TParent, injector, aux::false_type, aux::true_type>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_1st_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_1st_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type_1st<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type_1st_ref<TParent, injector, aux::false_type, aux::true_type>{*this};
   }
-  template <class TIsRoot = aux::false_type, class T, class TName>
-  auto create_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&) const {
-    return create_impl__<TIsRoot, T, TName>();
+  template <class TIsRoot = aux::false_type, class T, class TName, class TParent = aux::none_type>
+  auto create_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&, const aux::type<TParent>& = {}) const {
+    return create_impl__<TIsRoot, T, TName, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class T>
-  auto create_successful_impl(const aux::type<T>&) const {
-    return create_successful_impl__<TIsRoot, T>();
+  template <class TIsRoot = aux::false_type, class T, class TParent = aux::none_type>
+  auto create_successful_impl(const aux::type<T>&, const aux::type<TParent>& = {}) const {
+    return create_successful_impl__<TIsRoot, T, no_name, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type_ref<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_1st_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_1st_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type_1st<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type_1st_ref<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class T, class TName>
-  auto create_successful_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&) const {
-    return create_successful_impl__<TIsRoot, T, TName>();
+  template <class TIsRoot = aux::false_type, class T, class TName, class TParent = aux::none_type>
+  auto create_successful_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&, const aux::type<TParent>& = {}) const {
+    return create_successful_impl__<TIsRoot, T, TName, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class T>
-  decltype(auto) create_successful_impl(const aux::type<self<T>>&) const {
+  template <class TIsRoot = aux::false_type, class T, class _ = aux::none_type>
+  decltype(auto) create_successful_impl(const aux::type<self<T>>&, const aux::type<_>& = {}) const {
     return *this;
   }
 
@@ -2350,9 +3598,9 @@ class injector : injector_base, pool<bindings_t<TDeps...>> {
   }
 #endif
   {}
-  template <class TIsRoot = aux::false_type, class T, class TName = no_name>
+  template <class TIsRoot = aux::false_type, class T, class TName = no_name, class TParent = aux::none_type>
   auto create_impl__() const {
-    auto&& dependency = binder::resolve<T, TName>((injector*)this);
+    auto&& dependency = binder::resolve<T, TName, core::dependency<scopes::deduce, aux::decay_t<T>>, TParent>((injector*)this);
     using dependency_t = aux::remove_reference_t<decltype(dependency)>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using provider_t = core::provider<ctor_t, TName, injector>;
@@ -2363,9 +3611,9 @@ class injector : injector_base, pool<bindings_t<TDeps...>> {
     return wrapper<T, wrapper_t>{
         static_cast<dependency__<dependency_t>&>(dependency).template create<T, TName>(provider_t{this})};
   }
-  template <class TIsRoot = aux::false_type, class T, class TName = no_name>
+  template <class TIsRoot = aux::false_type, class T, class TName = no_name, class TParent = aux::none_type>
   auto create_successful_impl__() const {
-    auto&& dependency = binder::resolve<T, TName>((injector*)this);
+    auto&& dependency = binder::resolve<T, TName, core::dependency<scopes::deduce, aux::decay_t<T>>, TParent>((injector*)this);
     using dependency_t = aux::remove_reference_t<decltype(dependency)>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using provider_t = successful::provider<ctor_t, injector>;
@@ -2377,18 +3625,47 @@ class injector : injector_base, pool<bindings_t<TDeps...>> {
     return successful::wrapper<create_t, wrapper_t>{
         static_cast<dependency__<dependency_t>&>(dependency).template create<T, TName>(provider_t{this})};
   }
+  template <class T>
+  void create_n_impl__(void* memory, decltype(sizeof(0)) size, decltype(sizeof(0))& created) const {
+    auto&& dependency = binder::resolve<T, no_name>((injector*)this);
+    using dependency_t = aux::remove_reference_t<decltype(dependency)>;
+    using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
+    using provider_t = successful::provider<ctor_t, injector>;
+    using wrapper_t =
+        decltype(static_cast<dependency__<dependency_t>&>(dependency).template create<T, no_name>(provider_t{this}));
+    using element_t = typename objects<T>::element;
+    using ctor_args_t = typename ctor_t::second::second;
+    policy::template call<arg_wrapper<T, no_name, aux::true_type, ctor_args_t, dependency_t, pool_t>>(TConfig::policies(this));
+    for (; created < size; ++created) {
+      new (static_cast<element_t*>(memory) + created) element_t{BOOST_DI_TYPE_WKND(T) successful::wrapper<T, wrapper_t>{
+          static_cast<dependency__<dependency_t>&>(dependency).template create<T, no_name>(provider_t{this})}};
+    }
+  }
+  template <class T>
+  T* create_at_impl__(void* memory) const {
+    using dependency_t = binder::resolve_t<injector, T>;
+    using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T*>::type;
+    using provider_t = successful::provider<ctor_t, injector>;
+    using ctor_args_t = typename ctor_t::second::second;
+    policy::template call<arg_wrapper<T*, no_name, aux::true_type, ctor_args_t, dependency_t, pool_t>>(TConfig::policies(this));
+    return provider_t{this}.get(type_traits::placement{memory});
+  }
 };
 template <class TConfig, class... TDeps>
 class injector<TConfig, pool<>, TDeps...> : injector_base, pool<bindings_t<TDeps...>> {
   friend class binder;
   template <class>
   friend struct pool;
+  template <class, class>
+  friend struct extern_create;
   using pool_t = pool<bindings_t<TDeps...>>;
 
  protected:
-  template <class T, class TName = no_name, class TIsRoot = aux::false_type>
+  template <class TParent>
+  using context_t = aux::conditional_t<has_contextual<bindings_t<TDeps...>>::value, TParent, aux::none_type>;
+  template <class T, class TName = no_name, class TIsRoot = aux::false_type, class TParent = aux::none_type>
   struct is_creatable {
-    using dependency_t = binder::resolve_t<injector, T, TName>;
+    using dependency_t = binder::resolve_t<injector, T, TName, dependency<scopes::deduce, aux::decay_t<T>>, TParent>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using ctor_args_t = typename ctor_t::second::second;
     static constexpr auto value =
@@ -2400,17 +3677,25 @@ class injector<TConfig, pool<>, TDeps...> : injector_base, pool<bindings_t<TDeps
  public:
   using deps = bindings_t<TDeps...>;
   using config = TConfig;
+  template <class T>
+  using storage_t = type_traits::placement::storage<typename binder::resolve_t<injector, T>::given>;
   injector(injector&&) = default;
   template <class... TArgs>
   explicit injector(const init&, TArgs... args) noexcept : injector{from_deps{}, static_cast<TArgs&&>(args)...} {}
   template <class TConfig_, class TPolicies_, class... TDeps_>
   explicit injector(injector<TConfig_, TPolicies_, TDeps_...>&& other) noexcept
       : injector{from_injector{}, static_cast<injector<TConfig_, TPolicies_, TDeps_...>&&>(other), deps{}} {}
-  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  template <class T, BOOST_DI_REQUIRES(extern_create<injector, T>::value) = 0>
+  T create() const {
+    return extern_create<injector, T>::create(*this);
+  }
+  template <class T, BOOST_DI_REQUIRES(aux::conditional_t<extern_create<injector, T>::value, aux::false_type,
+                                                          is_creatable<T, no_name, aux::true_type>>::value) = 0>
   T create() const {
     return BOOST_DI_TYPE_WKND(T) create_successful_impl<aux::true_type>(aux::type<T>{});
   }
-  template <class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, aux::true_type>::value) = 0>
+  template <class T, BOOST_DI_REQUIRES(!aux::conditional_t<extern_create<injector, T>::value, aux::true_type,
+                                                           is_creatable<T, no_name, aux::true_type>>::value) = 0>
   BOOST_DI_DEPRECATED("creatable constraint not satisfied")
   T
       // clang-format off
@@ -2420,85 +3705,126 @@ class injector<TConfig, pool<>, TDeps...> : injector_base, pool<bindings_t<TDeps
     return BOOST_DI_TYPE_WKND(T) create_impl<aux::true_type>(aux::type<T>{});
   }
 
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  objects<T> create_n(decltype(sizeof(0)) size) const {
+    return objects<T>{size, [this](void* memory, decltype(sizeof(0)) size, decltype(sizeof(0))& created) {
+                        create_n_impl__<T>(memory, size, created);
+                      }};
+  }
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  T* create_into(void* memory, decltype(sizeof(0)) size) const {
+    struct rollback {
+      ~rollback() noexcept {
+        while (created) {
+          static_cast<T*>(memory)[--created].~T();
+        }
+      }
+      void* memory;
+      decltype(sizeof(0)) created;
+    } guard{memory, 0};
+    create_n_impl__<T>(memory, size, guard.created);
+    guard.created = 0;
+    return &static_cast<typename objects<T>::element*>(memory)->object;
+  }
+  template <class T, BOOST_DI_REQUIRES(aux::conditional_t<is_placeable<binder::resolve_t<injector, T>>::value,
+                                                          is_creatable<T*, no_name, aux::true_type>,
+                                                          aux::false_type>::value) = 0>
+  T& create_at(void* memory) const {
+    return *create_at_impl__<T>(memory);
+  }
+
  protected:
-  template <class T>
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  T create_extern__() const {
+    return BOOST_DI_TYPE_WKND(T) create_successful_impl<aux::true_type>(aux::type<T>{});
+  }
+  template <class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, aux::true_type>::value) = 0>
+  BOOST_DI_DEPRECATED("creatable constraint not satisfied")
+  T
+      // clang-format off
+  create_extern__
+      // clang-format on
+      () const {
+    return BOOST_DI_TYPE_WKND(T) create_impl<aux::true_type>(aux::type<T>{});
+  }
+  template <class T, class TParent = aux::none_type>
   struct try_create {
-    using type = aux::conditional_t<is_creatable<T>::value, T, void>;
+    using type = aux::conditional_t<is_creatable<T, no_name, aux::false_type, TParent>::value, T, void>;
   };
-  template <class TParent>
-  struct try_create<any_type_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_fwd<TParent>, _> {
     using type = any_type<TParent, injector, with_error>;
   };
-  template <class TParent>
-  struct try_create<any_type_ref_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_ref_fwd<TParent>, _> {
     using type = any_type_ref<TParent, injector, with_error>;
   };
-  template <class TParent>
-  struct try_create<any_type_1st_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_1st_fwd<TParent>, _> {
     using type = any_type_1st<TParent, injector, with_error>;
   };
-  template <class TParent>
-  struct try_create<any_type_1st_ref_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_1st_ref_fwd<TParent>, _> {
     using type = any_type_1st_ref<TParent, injector, with_error>;
   };
-  template <class TName, class T>
-  struct try_create<::boost::di::v1_0_1::named<TName, T>> {
-    using type = aux::conditional_t<is_creatable<T, TName>::value, T, void>;
+  template <class TName, class T, class TParent>
+  struct try_create<::boost::di::v1_0_1::named<TName, T>, TParent> {
+    using type = aux::conditional_t<is_creatable<T, TName, aux::false_type, TParent>::value, T, void>;
   };
-  template <class T>
-  struct try_create<self<T>> {
+  template <class T, class _>
+  struct try_create<self<T>, _> {
     using type = injector;
   };
-  template <class TIsRoot = aux::false_type, class T>
-  auto create_impl(const aux::type<T>&) const {
-    return create_impl__<TIsRoot, T>();
+  template <class TIsRoot = aux::false_type, class T, class TParent = aux::none_type>
+  auto create_impl(const aux::type<T>&, const aux::type<TParent>& = {}) const {
+    return create_impl__<TIsRoot, T, no_name, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type_ref<TParent, injector, aux::false_type, aux::true_type>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_1st_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_1st_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type_1st<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return any_type_1st_ref<TParent, injector, aux::false_type, aux::true_type>{*this};
   }
-  template <class TIsRoot = aux::false_type, class T, class TName>
-  auto create_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&) const {
-    return create_impl__<TIsRoot, T, TName>();
+  template <class TIsRoot = aux::false_type, class T, class TName, class TParent = aux::none_type>
+  auto create_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&, const aux::type<TParent>& = {}) const {
+    return create_impl__<TIsRoot, T, TName, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class T>
-  auto create_successful_impl(const aux::type<T>&) const {
-    return create_successful_impl__<TIsRoot, T>();
+  template <class TIsRoot = aux::false_type, class T, class TParent = aux::none_type>
+  auto create_successful_impl(const aux::type<T>&, const aux::type<TParent>& = {}) const {
+    return create_successful_impl__<TIsRoot, T, no_name, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type_ref<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_1st_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_1st_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type_1st<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&) const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&, const aux::type<_>& = {}) const {
     return successful::any_type_1st_ref<TParent, injector>{*this};
   }
-  template <class TIsRoot = aux::false_type, class T, class TName>
-  auto create_successful_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&) const {
-    return create_successful_impl__<TIsRoot, T, TName>();
+  template <class TIsRoot = aux::false_type, class T, class TName, class TParent = aux::none_type>
+  auto create_successful_impl(const aux::type<::boost::di::v1_0_1::named<TName, T>>&, const aux::type<TParent>& = {}) const {
+    return create_successful_impl__<TIsRoot, T, TName, TParent>();
   }
-  template <class TIsRoot = aux::false_type, class T>
-  decltype(auto) create_successful_impl(const aux::type<self<T>>&) const {
+  template <class TIsRoot = aux::false_type, class T, class _ = aux::none_type>
+  decltype(auto) create_successful_impl(const aux::type<self<T>>&, const aux::type<_>& = {}) const {
     return *this;
   }
 
@@ -2518,9 +3844,9 @@ class injector<TConfig, pool<>, TDeps...> : injector_base, pool<bindings_t<TDeps
   }
 #endif
   {}
-  template <class TIsRoot = aux::false_type, class T, class TName = no_name>
+  template <class TIsRoot = aux::false_type, class T, class TName = no_name, class TParent = aux::none_type>
   auto create_impl__() const {
-    auto&& dependency = binder::resolve<T, TName>((injector*)this);
+    auto&& dependency = binder::resolve<T, TName, core::dependency<scopes::deduce, aux::decay_t<T>>, TParent>((injector*)this);
     using dependency_t = aux::remove_reference_t<decltype(dependency)>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using provider_t = core::provider<ctor_t, TName, injector>;
@@ -2529,9 +3855,9 @@ class injector<TConfig, pool<>, TDeps...> : injector_base, pool<bindings_t<TDeps
     return wrapper<T, wrapper_t>{
         static_cast<dependency__<dependency_t>&>(dependency).template create<T, TName>(provider_t{this})};
   }
-  template <class TIsRoot = aux::false_type, class T, class TName = no_name>
+  template <class TIsRoot = aux::false_type, class T, class TName = no_name, class TParent = aux::none_type>
   auto create_successful_impl__() const {
-    auto&& dependency = binder::resolve<T, TName>((injector*)this);
+    auto&& dependency = binder::resolve<T, TName, core::dependency<scopes::deduce, aux::decay_t<T>>, TParent>((injector*)this);
     using dependency_t = aux::remove_reference_t<decltype(dependency)>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using provider_t = successful::provider<ctor_t, injector>;
@@ -2541,7 +3867,32 @@ class injector<TConfig, pool<>, TDeps...> : injector_base, pool<bindings_t<TDeps
     return successful::wrapper<create_t, wrapper_t>{
         static_cast<dependency__<dependency_t>&>(dependency).template create<T, TName>(provider_t{this})};
   }
+  template <class T>
+  void create_n_impl__(void* memory, decltype(sizeof(0)) size, decltype(sizeof(0))& created) const {
+    auto&& dependency = binder::resolve<T, no_name>((injector*)this);
+    using dependency_t = aux::remove_reference_t<decltype(dependency)>;
+    using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
+    using provider_t = successful::provider<ctor_t, injector>;
+    using wrapper_t =
+        decltype(static_cast<dependency__<dependency_t>&>(dependency).template create<T, no_name>(provider_t{this}));
+    using element_t = typename objects<T>::element;
+    for (; created < size; ++created) {
+      new (static_cast<element_t*>(memory) + created) element_t{BOOST_DI_TYPE_WKND(T) successful::wrapper<T, wrapper_t>{
+          static_cast<dependency__<dependency_t>&>(dependency).template create<T, no_name>(provider_t{this})}};
+    }
+  }
+  template <class T>
+  T* create_at_impl__(void* memory) const {
+    using dependency_t = binder::resolve_t<injector, T>;
+    using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T*>::type;
+    using provider_t = successful::provider<ctor_t, injector>;
+    return provider_t{this}.get(type_traits::placement{memory});
+  }
 };
+template <class TConfig, class TPolicies, class... TDeps>
+injector<TConfig, TPolicies, TDeps...> injector_type(const injector<TConfig, TPolicies, TDeps...>&);
+template <class TInjector>
+using injector_t = decltype(injector_type(aux::declval<const TInjector&>()));
 }
 namespace concepts {
 struct get {};
@@ -2662,6 +4013,8 @@ using injector = detail::injector<
 #define BOOST_DI_EXPOSE_IMPL__(...) decltype(::boost::di::v1_0_1::detail::__VA_ARGS__),
 #define BOOST_DI_EXPOSE_IMPL(...) ::boost::di::v1_0_1::named<BOOST_DI_EXPOSE_IMPL__ __VA_ARGS__>
 #define BOOST_DI_EXPOSE(...) BOOST_DI_IF(BOOST_DI_IBP(__VA_ARGS__), BOOST_DI_EXPOSE_IMPL, BOOST_DI_EXPAND)(__VA_ARGS__)
+#define BOOST_DI_EXTERN_CREATE(TInjector, ...) template <> constexpr bool ::boost::di::v1_0_1::core::is_extern_create<::boost::di::v1_0_1::core::injector_t<TInjector>, __VA_ARGS__> = true; template <> auto ::boost::di::v1_0_1::core::extern_create<::boost::di::v1_0_1::core::injector_t<TInjector>, __VA_ARGS__>::create(const ::boost::di::v1_0_1::core::injector_t<TInjector>&) -> __VA_ARGS__
+#define BOOST_DI_INSTANTIATE_CREATE(TInjector, ...) template <> auto ::boost::di::v1_0_1::core::extern_create<::boost::di::v1_0_1::core::injector_t<TInjector>, __VA_ARGS__>::create(const ::boost::di::v1_0_1::core::injector_t<TInjector>& injector) -> __VA_ARGS__ { return injector.template create_extern__<__VA_ARGS__>(); }
 // clang-format on
 #if defined(__MSVC__)
 #define BOOST_DI_MAKE_INJECTOR(...) __VA_ARGS__
@@ -2685,6 +4038,145 @@ inline auto make_injector(TDeps... args) noexcept {
       core::injector<TConfig, decltype(((TConfig*)0)->policies((concepts::injector<TConfig>*)0)), TDeps...>{
           core::init{}, static_cast<TDeps&&>(args)...});
 }
+#if !defined(BOOST_DI_ASSERT)
+#if defined(__MSVC__)
+#define BOOST_DI_ASSERT(...) ((__VA_ARGS__) ? (void)0 : __debugbreak())
+#else
+#define BOOST_DI_ASSERT(...) ((__VA_ARGS__) ? (void)0 : __builtin_trap())
+#endif
+#endif
+template <class... Ts>
+class one_of {
+  template <decltype(sizeof(0))...>
+  struct max;
+  template <decltype(sizeof(0)) N>
+  struct max<N> : aux::integral_constant<decltype(sizeof(0)), N> {};
+  template <decltype(sizeof(0)) N, decltype(sizeof(0)) M, decltype(sizeof(0))... Ns>
+  struct max<N, M, Ns...> : max<(N > M ? N : M), Ns...> {};
+  struct storage {
+    alignas(max<alignof(Ts)...>::value) unsigned char data[max<sizeof(Ts)...>::value];
+  };
+  template <class T, class...>
+  struct first {
+    using type = T;
+  };
+  template <class T, class TInjector>
+  static void create(void* memory, const TInjector& injector) {
+    injector.template create_at<T>(memory);
+  }
+  template <class T>
+  static void move(void* object, void* memory) noexcept(aux::is_nothrow_move_constructible<T>::value) {
+    new (memory) type_traits::placement::direct<T>(static_cast<T&&>(*static_cast<T*>(object)));
+  }
+  template <class T>
+  static void destroy(void* object) noexcept {
+    static_cast<T*>(object)->~T();
+  }
+  template <class T, class TVisitor>
+  static decltype(auto) apply(void* object, TVisitor& visitor) {
+    return visitor(*static_cast<T*>(object));
+  }
+  template <class T, class TVisitor>
+  static decltype(auto) apply(const void* object, TVisitor& visitor) {
+    return visitor(*static_cast<const T*>(object));
+  }
+  template <class T, class... Tx>
+  struct index_of;
+  template <class T, class... Tx>
+  struct index_of<T, T, Tx...> : aux::integral_constant<decltype(sizeof(0)), 0> {};
+  template <class T, class TOther, class... Tx>
+  struct index_of<T, TOther, Tx...> : aux::integral_constant<decltype(sizeof(0)), 1 + index_of<T, Tx...>::value> {};
+
+ public:
+  using size_type = decltype(sizeof(0));
+  template <class TSelector>
+  struct selector {
+    template <class TInjector>
+    one_of operator()(const TInjector& injector) const {
+      return one_of{static_cast<size_type>(selector_()), injector};
+    }
+    TSelector selector_;
+  };
+  template <class TInjector>
+  one_of(size_type index, const TInjector& injector) : index_(index) {
+    BOOST_DI_ASSERT(index < sizeof...(Ts));
+    using create_t = void (*)(void*, const TInjector&);
+    static constexpr create_t create_[] = {&create<Ts, TInjector>...};
+    create_[index_](&storage_, injector);
+  }
+  one_of(one_of&& other) noexcept(aux::is_same<aux::bool_list<aux::always<Ts>::value...>,
+                                               aux::bool_list<aux::is_nothrow_move_constructible<Ts>::value...>>::value)
+      : index_(other.index_) {
+    using move_t = void (*)(void*, void*);
+    static constexpr move_t move_[] = {&move<Ts>...};
+    move_[index_](&other.storage_, &storage_);
+  }
+  one_of(const one_of&) = delete;
+  one_of& operator=(const one_of&) = delete;
+  one_of& operator=(one_of&&) = delete;
+  ~one_of() noexcept {
+    using destroy_t = void (*)(void*);
+    static constexpr destroy_t destroy_[] = {&destroy<Ts>...};
+    destroy_[index_](&storage_);
+  }
+  size_type index() const noexcept { return index_; }
+  template <class T>
+  T* get_if() noexcept {
+    return index_ == index_of<T, Ts...>::value ? static_cast<T*>(static_cast<void*>(&storage_)) : nullptr;
+  }
+  template <class T>
+  const T* get_if() const noexcept {
+    return index_ == index_of<T, Ts...>::value ? static_cast<const T*>(static_cast<const void*>(&storage_)) : nullptr;
+  }
+  template <class TVisitor>
+  decltype(auto) visit(TVisitor visitor) {
+    using apply_t = decltype(apply<typename first<Ts...>::type, TVisitor>((void*)0, visitor)) (*)(void*, TVisitor&);
+    static constexpr apply_t apply_[] = {&apply<Ts, TVisitor>...};
+    return apply_[index_](&storage_, visitor);
+  }
+  template <class TVisitor>
+  decltype(auto) visit(TVisitor visitor) const {
+    using apply_t = decltype(apply<typename first<Ts...>::type, TVisitor>((const void*)0, visitor)) (*)(const void*, TVisitor&);
+    static constexpr apply_t apply_[] = {&apply<Ts, TVisitor>...};
+    return apply_[index_](&storage_, visitor);
+  }
+
+ private:
+  storage storage_;
+  size_type index_ = 0;
+};
+template <class I, class TImpl = I>
+class sealed {
+ public:
+  sealed() noexcept = default;
+  template <class T, BOOST_DI_REQUIRES(aux::is_convertible<T*, TImpl*>::value && aux::is_convertible<T*, I*>::value) = 0>
+  explicit sealed(aux::owner<T*> object) noexcept : object_(object) {}
+  sealed(sealed&& other) noexcept : object_(other.object_) { other.object_ = nullptr; }
+  sealed& operator=(sealed&& other) noexcept {
+    if (this != &other) {
+      delete object_;
+      object_ = other.object_;
+      other.object_ = nullptr;
+    }
+    return *this;
+  }
+  sealed(const sealed&) = delete;
+  sealed& operator=(const sealed&) = delete;
+  ~sealed() noexcept { delete object_; }
+  TImpl* get() const noexcept { return object_; }
+  TImpl& operator*() const noexcept { return *object_; }
+  TImpl* operator->() const noexcept { return object_; }
+  explicit operator bool() const noexcept { return object_; }
+
+ private:
+  TImpl* object_ = nullptr;
+};
+template <class I, class TImpl>
+struct smart_ptr_traits<sealed<I, TImpl>> {
+  using element_type = I;
+};
+template <class TInjector, class I, class TGiven = typename core::binder::resolve_t<TInjector, I>::given>
+using sealed_t = sealed<I, aux::conditional_t<aux::is_base_of<I, TGiven>::value, TGiven, I>>;
 namespace policies {
 namespace detail {
 struct type_op {};
@@ -2815,6 +4307,110 @@ class heap {
   }
 };
 }
+namespace providers {
+class monotonic_buffer {
+  using size_t = decltype(sizeof(0));
+
+ public:
+  monotonic_buffer(void* data, size_t size) noexcept : data_(static_cast<char*>(data)), size_(size) {}
+  template <size_t N>
+  explicit monotonic_buffer(unsigned char (&data)[N]) noexcept : monotonic_buffer(data, N) {}
+  monotonic_buffer(const monotonic_buffer&) = delete;
+  monotonic_buffer& operator=(const monotonic_buffer&) = delete;
+  void* allocate(size_t size, size_t alignment) noexcept {
+    const auto address = reinterpret_cast<size_t>(data_ + used_);
+    const auto padding = (alignment - address % alignment) % alignment;
+    if (padding + size > size_ - used_) {
+      return nullptr;
+    }
+    auto ptr = data_ + used_ + padding;
+    used_ += padding + size;
+    return ptr;
+  }
+  bool owns(const void* ptr) const noexcept {
+    return static_cast<const char*>(ptr) >= data_ && static_cast<const char*>(ptr) < data_ + size_;
+  }
+  void release() noexcept { used_ = 0; }
+  size_t size() const noexcept { return size_; }
+  size_t used() const noexcept { return used_; }
+
+ private:
+  char* data_ = nullptr;
+  size_t size_ = 0;
+  size_t used_ = 0;
+};
+class arena {
+ public:
+  class deleter {
+   public:
+    deleter() noexcept = default;
+    explicit deleter(const monotonic_buffer* buffer) noexcept : buffer_(buffer) {}
+    template <class T>
+    void operator()(T* ptr) const noexcept {
+      if (buffer_ && buffer_->owns(ptr)) {
+        ptr->~T();
+      } else {
+        delete ptr;
+      }
+    }
+
+   private:
+    const monotonic_buffer* buffer_ = nullptr;
+  };
+  template <class TInitialization, class T, class... TArgs>
+  struct is_creatable {
+    static constexpr auto value = concepts::creatable<TInitialization, T, TArgs...>::value;
+  };
+  explicit arena(monotonic_buffer& buffer) noexcept : buffer_(&buffer) {}
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::heap&, TArgs&&... args) const {
+    using object_t = type_traits::placement::direct<T>;
+    if (auto memory = buffer_->allocate(sizeof(object_t), alignof(object_t))) {
+      return std::unique_ptr<T, deleter>{&(new (memory) object_t(static_cast<TArgs&&>(args)...))->object, deleter{buffer_}};
+    }
+    return std::unique_ptr<T, deleter>{new T(static_cast<TArgs&&>(args)...), deleter{buffer_}};
+  }
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::heap&, TArgs&&... args) const {
+    using object_t = type_traits::placement::uniform<T>;
+    if (auto memory = buffer_->allocate(sizeof(object_t), alignof(object_t))) {
+      return std::unique_ptr<T, deleter>{&(new (memory) object_t(static_cast<TArgs&&>(args)...))->object, deleter{buffer_}};
+    }
+    return std::unique_ptr<T, deleter>{new T{static_cast<TArgs&&>(args)...}, deleter{buffer_}};
+  }
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::direct<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::uniform<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) const {
+    return poly<I, N>{aux::type<T>{}, [&](void* memory) {
+                        return get<T>(init, type_traits::placement{memory}, static_cast<TArgs&&>(args)...);
+                      }};
+  }
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(!poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) const {
+    return poly<I, N>{heap{}.get<T>(init, type_traits::heap{}, static_cast<TArgs&&>(args)...)};
+  }
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::stack&, TArgs&&... args) const noexcept {
+    return T(static_cast<TArgs&&>(args)...);
+  }
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::stack&, TArgs&&... args) const noexcept {
+    return T{static_cast<TArgs&&>(args)...};
+  }
+
+ private:
+  monotonic_buffer* buffer_ = nullptr;
+};
+}
 #define BOOST_DI_IF(cond, t, f) BOOST_DI_IF_I(cond, t, f)
 #define BOOST_DI_REPEAT(i, m, ...) BOOST_DI_REPEAT_N(i, m, __VA_ARGS__)
 #define BOOST_DI_CAT(a, ...) BOOST_DI_PRIMITIVE_CAT(a, __VA_ARGS__)
@@ -2822,7 +4418,9 @@ class heap {
 #define BOOST_DI_COMMA() ,
 #define BOOST_DI_EAT(...)
 #define BOOST_DI_EXPAND(...) __VA_ARGS__
-#define BOOST_DI_SIZE(...) BOOST_DI_CAT(BOOST_DI_VARIADIC_SIZE_I(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, ), )
+#define BOOST_DI_SIZE(...)                                                                                                   \
+  BOOST_DI_CAT(BOOST_DI_VARIADIC_SIZE_I(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, \
+                                        14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, ), )
 #define BOOST_DI_PRIMITIVE_CAT(a, ...) a##__VA_ARGS__
 #define BOOST_DI_ELEM(n, ...) BOOST_DI_ELEM_I(n, __VA_ARGS__)
 #define BOOST_DI_IS_EMPTY(...) \
@@ -2832,7 +4430,9 @@ class heap {
 #define BOOST_DI_DETAIL_IS_EMPTY_IIF(bit) BOOST_DI_DETAIL_IS_EMPTY_PRIMITIVE_CAT(BOOST_DI_DETAIL_IS_EMPTY_IIF_, bit)
 #define BOOST_DI_DETAIL_IS_EMPTY_NON_FUNCTION_C(...) ()
 #define BOOST_DI_DETAIL_IS_EMPTY_GEN_ZERO(...) 0
-#define BOOST_DI_VARIADIC_SIZE_I(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, size, ...) size
+#define BOOST_DI_VARIADIC_SIZE_I(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, \
+                                 e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, size, ...)                    \
+  size
 #define BOOST_DI_IF_I(cond, t, f) BOOST_DI_IIF(cond, t, f)
 #define BOOST_DI_IIF_0(t, f) f
 #define BOOST_DI_IIF_1(t, f) t
@@ -2844,6 +4444,28 @@ class heap {
 #define BOOST_DI_IIF_7(t, f) t
 #define BOOST_DI_IIF_8(t, f) t
 #define BOOST_DI_IIF_9(t, f) t
+#define BOOST_DI_IIF_10(t, f) t
+#define BOOST_DI_IIF_11(t, f) t
+#define BOOST_DI_IIF_12(t, f) t
+#define BOOST_DI_IIF_13(t, f) t
+#define BOOST_DI_IIF_14(t, f) t
+#define BOOST_DI_IIF_15(t, f) t
+#define BOOST_DI_IIF_16(t, f) t
+#define BOOST_DI_IIF_17(t, f) t
+#define BOOST_DI_IIF_18(t, f) t
+#define BOOST_DI_IIF_19(t, f) t
+#define BOOST_DI_IIF_20(t, f) t
+#define BOOST_DI_IIF_21(t, f) t
+#define BOOST_DI_IIF_22(t, f) t
+#define BOOST_DI_IIF_23(t, f) t
+#define BOOST_DI_IIF_24(t, f) t
+#define BOOST_DI_IIF_25(t, f) t
+#define BOOST_DI_IIF_26(t, f) t
+#define BOOST_DI_IIF_27(t, f) t
+#define BOOST_DI_IIF_28(t, f) t
+#define BOOST_DI_IIF_29(t, f) t
+#define BOOST_DI_IIF_30(t, f) t
+#define BOOST_DI_IIF_31(t, f) t
 #define BOOST_DI_ELEM_I(n, ...) BOOST_DI_CAT(BOOST_DI_CAT(BOOST_DI_ELEM, n)(__VA_ARGS__, ), )
 #define BOOST_DI_ELEM0(p1, ...) p1
 #define BOOST_DI_ELEM1(p1, p2, ...) p2
@@ -2855,6 +4477,50 @@ class heap {
 #define BOOST_DI_ELEM7(p1, p2, p3, p4, p5, p6, p7, p8, ...) p8
 #define BOOST_DI_ELEM8(p1, p2, p3, p4, p5, p6, p7, p8, p9, ...) p9
 #define BOOST_DI_ELEM9(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, ...) p10
+#define BOOST_DI_ELEM10(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, ...) p11
+#define BOOST_DI_ELEM11(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, ...) p12
+#define BOOST_DI_ELEM12(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, ...) p13
+#define BOOST_DI_ELEM13(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, ...) p14
+#define BOOST_DI_ELEM14(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, ...) p15
+#define BOOST_DI_ELEM15(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, ...) p16
+#define BOOST_DI_ELEM16(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, ...) p17
+#define BOOST_DI_ELEM17(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, ...) p18
+#define BOOST_DI_ELEM18(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, ...) p19
+#define BOOST_DI_ELEM19(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, ...) p20
+#define BOOST_DI_ELEM20(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, ...) p21
+#define BOOST_DI_ELEM21(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        ...)                                                                                                 \
+  p22
+#define BOOST_DI_ELEM22(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, ...)                                                                                            \
+  p23
+#define BOOST_DI_ELEM23(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, ...)                                                                                       \
+  p24
+#define BOOST_DI_ELEM24(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, ...)                                                                                  \
+  p25
+#define BOOST_DI_ELEM25(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, ...)                                                                             \
+  p26
+#define BOOST_DI_ELEM26(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, ...)                                                                        \
+  p27
+#define BOOST_DI_ELEM27(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, ...)                                                                   \
+  p28
+#define BOOST_DI_ELEM28(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, ...)                                                              \
+  p29
+#define BOOST_DI_ELEM29(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, p30, ...)                                                         \
+  p30
+#define BOOST_DI_ELEM30(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, p30, p31, ...)                                                    \
+  p31
+#define BOOST_DI_ELEM31(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, ...)                                               \
+  p32
 #define BOOST_DI_REPEAT_N(i, m, ...) BOOST_DI_REPEAT_##i(m, __VA_ARGS__)
 #define BOOST_DI_REPEAT_1(m, ...) m(0, __VA_ARGS__)
 #define BOOST_DI_REPEAT_2(m, ...) m(0, __VA_ARGS__) m(1, __VA_ARGS__)
@@ -2863,8 +4529,9 @@ class heap {
 #define BOOST_DI_REPEAT_5(m, ...) m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__)
 #define BOOST_DI_REPEAT_6(m, ...) \
   m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)
-#define BOOST_DI_REPEAT_7(m, ...) \
-  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) m(6, __VA_ARGS__)
+#define BOOST_DI_REPEAT_7(m, ...)                                                                             \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
+      m(6, __VA_ARGS__)
 #define BOOST_DI_REPEAT_8(m, ...)                                                                             \
   m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
       m(6, __VA_ARGS__) m(7, __VA_ARGS__)
@@ -2874,6 +4541,116 @@ class heap {
 #define BOOST_DI_REPEAT_10(m, ...)                                                                            \
   m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
       m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__)
+#define BOOST_DI_REPEAT_11(m, ...)                                                                            \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__)
+#define BOOST_DI_REPEAT_12(m, ...)                                                                            \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)
+#define BOOST_DI_REPEAT_13(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__)
+#define BOOST_DI_REPEAT_14(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__)
+#define BOOST_DI_REPEAT_15(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__)
+#define BOOST_DI_REPEAT_16(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__)
+#define BOOST_DI_REPEAT_17(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__)
+#define BOOST_DI_REPEAT_18(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__)
+#define BOOST_DI_REPEAT_19(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__)
+#define BOOST_DI_REPEAT_20(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__)
+#define BOOST_DI_REPEAT_21(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__)
+#define BOOST_DI_REPEAT_22(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__)
+#define BOOST_DI_REPEAT_23(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__)
+#define BOOST_DI_REPEAT_24(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__)
+#define BOOST_DI_REPEAT_25(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__)
+#define BOOST_DI_REPEAT_26(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__)
+#define BOOST_DI_REPEAT_27(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__)
+#define BOOST_DI_REPEAT_28(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__)
+#define BOOST_DI_REPEAT_29(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__)
+#define BOOST_DI_REPEAT_30(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__) m(29, __VA_ARGS__)
+#define BOOST_DI_REPEAT_31(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__) m(29, __VA_ARGS__) \
+      m(30, __VA_ARGS__)
+#define BOOST_DI_REPEAT_32(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__) m(29, __VA_ARGS__) \
+      m(30, __VA_ARGS__) m(31, __VA_ARGS__)
 #if defined(__MSVC__)
 #define BOOST_DI_VD_IBP_CAT(a, b) BOOST_DI_VD_IBP_CAT_I(a, b)
 #define BOOST_DI_VD_IBP_CAT_I(a, b) BOOST_DI_VD_IBP_CAT_II(a##b)
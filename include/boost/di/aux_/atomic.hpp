@@ -0,0 +1,91 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_AUX_ATOMIC_HPP
+#define BOOST_DI_AUX_ATOMIC_HPP
+
+#include "boost/di/aux_/compiler.hpp"
+
+namespace aux {
+
+#if defined(__MSVC__)  // __pph__
+extern "C" void* _InterlockedCompareExchangePointer(void* volatile*, void*, void*);
+extern "C" void* _InterlockedExchangePointer(void* volatile*, void*);
+extern "C" long _InterlockedIncrement(long volatile*);
+extern "C" long _InterlockedDecrement(long volatile*);
+#pragma intrinsic(_InterlockedCompareExchangePointer, _InterlockedExchangePointer, _InterlockedIncrement)  // __pph__
+#pragma intrinsic(_InterlockedDecrement)                                                                     // __pph__
+
+template <class T>
+inline T* atomic_load(T* const* ptr) noexcept {
+  return *static_cast<T* const volatile*>(ptr);
+}
+
+inline long atomic_load(const long* ptr) noexcept { return *static_cast<const volatile long*>(ptr); }
+
+template <class T>
+inline void atomic_store(T** ptr, T* value) noexcept {
+  _InterlockedExchangePointer(reinterpret_cast<void* volatile*>(ptr), value);
+}
+
+template <class T>
+inline bool atomic_compare_exchange(T** ptr, T* expected, T* desired) noexcept {
+  return _InterlockedCompareExchangePointer(reinterpret_cast<void* volatile*>(ptr), desired, expected) == expected;
+}
+
+inline long atomic_increment(long* ptr) noexcept { return _InterlockedIncrement(ptr); }
+
+inline long atomic_decrement(long* ptr) noexcept { return _InterlockedDecrement(ptr); }
+
+inline void atomic_pause() noexcept {}
+#else   // __pph__
+template <class T>
+inline T* atomic_load(T* const* ptr) noexcept {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+inline long atomic_load(const long* ptr) noexcept { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+
+template <class T>
+inline void atomic_store(T** ptr, T* value) noexcept {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+template <class T>
+inline bool atomic_compare_exchange(T** ptr, T* expected, T* desired) noexcept {
+  return __atomic_compare_exchange_n(ptr, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+inline long atomic_increment(long* ptr) noexcept { return __atomic_add_fetch(ptr, 1, __ATOMIC_ACQ_REL); }
+
+inline long atomic_decrement(long* ptr) noexcept { return __atomic_sub_fetch(ptr, 1, __ATOMIC_ACQ_REL); }
+
+inline void atomic_pause() noexcept {
+#if defined(__i386__) || defined(__x86_64__)  // __pph__
+  __builtin_ia32_pause();
+#endif  // __pph__
+}
+#endif  // __pph__
+
+#if defined(_WIN32) || defined(_WIN64)  // __pph__
+extern "C" __declspec(dllimport) int __stdcall SwitchToThread();
+
+inline void atomic_yield() noexcept { SwitchToThread(); }
+#else  // __pph__
+#define BOOST_DI_SYMBOL_IMPL(prefix, name) #prefix name
+#define BOOST_DI_SYMBOL(prefix, name) BOOST_DI_SYMBOL_IMPL(prefix, name)
+
+// sched_yield under a distinct name, so that its exception specification doesn't have to match the libc one
+int sched_yield__() noexcept __asm__(BOOST_DI_SYMBOL(__USER_LABEL_PREFIX__, "sched_yield"));
+#undef BOOST_DI_SYMBOL  // __pph__
+#undef BOOST_DI_SYMBOL_IMPL  // __pph__
+
+inline void atomic_yield() noexcept { sched_yield__(); }
+#endif  // __pph__
+
+}  // aux
+
+#endif
@@ -16,7 +16,9 @@
 #define BOOST_DI_COMMA() ,
 #define BOOST_DI_EAT(...)
 #define BOOST_DI_EXPAND(...) __VA_ARGS__
-#define BOOST_DI_SIZE(...) BOOST_DI_CAT(BOOST_DI_VARIADIC_SIZE_I(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, ), )
+#define BOOST_DI_SIZE(...)                                                                                                   \
+  BOOST_DI_CAT(BOOST_DI_VARIADIC_SIZE_I(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, \
+                                        14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, ), )
 #define BOOST_DI_PRIMITIVE_CAT(a, ...) a##__VA_ARGS__
 #define BOOST_DI_ELEM(n, ...) BOOST_DI_ELEM_I(n, __VA_ARGS__)
 #define BOOST_DI_IS_EMPTY(...) \
@@ -27,7 +29,9 @@
 #define BOOST_DI_DETAIL_IS_EMPTY_IIF(bit) BOOST_DI_DETAIL_IS_EMPTY_PRIMITIVE_CAT(BOOST_DI_DETAIL_IS_EMPTY_IIF_, bit)
 #define BOOST_DI_DETAIL_IS_EMPTY_NON_FUNCTION_C(...) ()
 #define BOOST_DI_DETAIL_IS_EMPTY_GEN_ZERO(...) 0
-#define BOOST_DI_VARIADIC_SIZE_I(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, size, ...) size
+#define BOOST_DI_VARIADIC_SIZE_I(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, \
+                                 e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, size, ...)                    \
+  size
 #define BOOST_DI_IF_I(cond, t, f) BOOST_DI_IIF(cond, t, f)
 #define BOOST_DI_IIF_0(t, f) f
 #define BOOST_DI_IIF_1(t, f) t
@@ -39,6 +43,28 @@
 #define BOOST_DI_IIF_7(t, f) t
 #define BOOST_DI_IIF_8(t, f) t
 #define BOOST_DI_IIF_9(t, f) t
+#define BOOST_DI_IIF_10(t, f) t
+#define BOOST_DI_IIF_11(t, f) t
+#define BOOST_DI_IIF_12(t, f) t
+#define BOOST_DI_IIF_13(t, f) t
+#define BOOST_DI_IIF_14(t, f) t
+#define BOOST_DI_IIF_15(t, f) t
+#define BOOST_DI_IIF_16(t, f) t
+#define BOOST_DI_IIF_17(t, f) t
+#define BOOST_DI_IIF_18(t, f) t
+#define BOOST_DI_IIF_19(t, f) t
+#define BOOST_DI_IIF_20(t, f) t
+#define BOOST_DI_IIF_21(t, f) t
+#define BOOST_DI_IIF_22(t, f) t
+#define BOOST_DI_IIF_23(t, f) t
+#define BOOST_DI_IIF_24(t, f) t
+#define BOOST_DI_IIF_25(t, f) t
+#define BOOST_DI_IIF_26(t, f) t
+#define BOOST_DI_IIF_27(t, f) t
+#define BOOST_DI_IIF_28(t, f) t
+#define BOOST_DI_IIF_29(t, f) t
+#define BOOST_DI_IIF_30(t, f) t
+#define BOOST_DI_IIF_31(t, f) t
 #define BOOST_DI_ELEM_I(n, ...) BOOST_DI_CAT(BOOST_DI_CAT(BOOST_DI_ELEM, n)(__VA_ARGS__, ), )
 #define BOOST_DI_ELEM0(p1, ...) p1
 #define BOOST_DI_ELEM1(p1, p2, ...) p2
@@ -50,6 +76,50 @@
 #define BOOST_DI_ELEM7(p1, p2, p3, p4, p5, p6, p7, p8, ...) p8
 #define BOOST_DI_ELEM8(p1, p2, p3, p4, p5, p6, p7, p8, p9, ...) p9
 #define BOOST_DI_ELEM9(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, ...) p10
+#define BOOST_DI_ELEM10(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, ...) p11
+#define BOOST_DI_ELEM11(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, ...) p12
+#define BOOST_DI_ELEM12(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, ...) p13
+#define BOOST_DI_ELEM13(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, ...) p14
+#define BOOST_DI_ELEM14(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, ...) p15
+#define BOOST_DI_ELEM15(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, ...) p16
+#define BOOST_DI_ELEM16(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, ...) p17
+#define BOOST_DI_ELEM17(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, ...) p18
+#define BOOST_DI_ELEM18(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, ...) p19
+#define BOOST_DI_ELEM19(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, ...) p20
+#define BOOST_DI_ELEM20(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, ...) p21
+#define BOOST_DI_ELEM21(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        ...)                                                                                                 \
+  p22
+#define BOOST_DI_ELEM22(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, ...)                                                                                            \
+  p23
+#define BOOST_DI_ELEM23(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, ...)                                                                                       \
+  p24
+#define BOOST_DI_ELEM24(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, ...)                                                                                  \
+  p25
+#define BOOST_DI_ELEM25(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, ...)                                                                             \
+  p26
+#define BOOST_DI_ELEM26(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, ...)                                                                        \
+  p27
+#define BOOST_DI_ELEM27(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, ...)                                                                   \
+  p28
+#define BOOST_DI_ELEM28(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, ...)                                                              \
+  p29
+#define BOOST_DI_ELEM29(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, p30, ...)                                                         \
+  p30
+#define BOOST_DI_ELEM30(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, p30, p31, ...)                                                    \
+  p31
+#define BOOST_DI_ELEM31(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, \
+                        p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, ...)                                               \
+  p32
 #define BOOST_DI_REPEAT_N(i, m, ...) BOOST_DI_REPEAT_##i(m, __VA_ARGS__)
 #define BOOST_DI_REPEAT_1(m, ...) m(0, __VA_ARGS__)
 #define BOOST_DI_REPEAT_2(m, ...) m(0, __VA_ARGS__) m(1, __VA_ARGS__)
@@ -58,8 +128,9 @@
 #define BOOST_DI_REPEAT_5(m, ...) m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__)
 #define BOOST_DI_REPEAT_6(m, ...) \
   m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)
-#define BOOST_DI_REPEAT_7(m, ...) \
-  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) m(6, __VA_ARGS__)
+#define BOOST_DI_REPEAT_7(m, ...)                                                                             \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
+      m(6, __VA_ARGS__)
 #define BOOST_DI_REPEAT_8(m, ...)                                                                             \
   m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
       m(6, __VA_ARGS__) m(7, __VA_ARGS__)
@@ -69,6 +140,116 @@
 #define BOOST_DI_REPEAT_10(m, ...)                                                                            \
   m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
       m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__)
+#define BOOST_DI_REPEAT_11(m, ...)                                                                            \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__)
+#define BOOST_DI_REPEAT_12(m, ...)                                                                            \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__) \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)
+#define BOOST_DI_REPEAT_13(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__)
+#define BOOST_DI_REPEAT_14(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__)
+#define BOOST_DI_REPEAT_15(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__)
+#define BOOST_DI_REPEAT_16(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__)
+#define BOOST_DI_REPEAT_17(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__)
+#define BOOST_DI_REPEAT_18(m, ...)                                                                                  \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)       \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__) \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__)
+#define BOOST_DI_REPEAT_19(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__)
+#define BOOST_DI_REPEAT_20(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__)
+#define BOOST_DI_REPEAT_21(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__)
+#define BOOST_DI_REPEAT_22(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__)
+#define BOOST_DI_REPEAT_23(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__)
+#define BOOST_DI_REPEAT_24(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__)
+#define BOOST_DI_REPEAT_25(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__)
+#define BOOST_DI_REPEAT_26(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__)
+#define BOOST_DI_REPEAT_27(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__)
+#define BOOST_DI_REPEAT_28(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__)
+#define BOOST_DI_REPEAT_29(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__)
+#define BOOST_DI_REPEAT_30(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__) m(29, __VA_ARGS__)
+#define BOOST_DI_REPEAT_31(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__) m(29, __VA_ARGS__) \
+      m(30, __VA_ARGS__)
+#define BOOST_DI_REPEAT_32(m, ...)                                                                                      \
+  m(0, __VA_ARGS__) m(1, __VA_ARGS__) m(2, __VA_ARGS__) m(3, __VA_ARGS__) m(4, __VA_ARGS__) m(5, __VA_ARGS__)           \
+      m(6, __VA_ARGS__) m(7, __VA_ARGS__) m(8, __VA_ARGS__) m(9, __VA_ARGS__) m(10, __VA_ARGS__) m(11, __VA_ARGS__)     \
+      m(12, __VA_ARGS__) m(13, __VA_ARGS__) m(14, __VA_ARGS__) m(15, __VA_ARGS__) m(16, __VA_ARGS__) m(17, __VA_ARGS__) \
+      m(18, __VA_ARGS__) m(19, __VA_ARGS__) m(20, __VA_ARGS__) m(21, __VA_ARGS__) m(22, __VA_ARGS__) m(23, __VA_ARGS__) \
+      m(24, __VA_ARGS__) m(25, __VA_ARGS__) m(26, __VA_ARGS__) m(27, __VA_ARGS__) m(28, __VA_ARGS__) m(29, __VA_ARGS__) \
+      m(30, __VA_ARGS__) m(31, __VA_ARGS__)
 
 #if defined(__MSVC__)
 #define BOOST_DI_VD_IBP_CAT(a, b) BOOST_DI_VD_IBP_CAT_I(a, b)
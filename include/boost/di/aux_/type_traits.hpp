@@ -35,7 +35,7 @@
 namespace aux {
 
 template <class T>
-T&& declval();
+T&& declval() noexcept;
 
 template <class T, T V>
 struct integral_constant {
@@ -101,7 +101,7 @@ struct remove_pointer<T*> {
 template <class T>
 using remove_pointer_t = typename remove_pointer<T>::type;
 
-template <class T>
+template <class T, class = int>
 struct remove_smart_ptr {
   using type = T;
 };
@@ -122,6 +122,10 @@ struct remove_smart_ptr<boost::shared_ptr<T>> {
   using type = T;
 };
 template <class T>
+struct remove_smart_ptr<T, valid_t<typename smart_ptr_traits<T>::element_type>> {
+  using type = typename smart_ptr_traits<T>::element_type;
+};
+template <class T>
 using remove_smart_ptr_t = typename remove_smart_ptr<T>::type;
 
 template <class T>
@@ -178,7 +182,7 @@ struct remove_extent<T[]> {
 template <class T>
 using remove_extent_t = typename remove_extent<T>::type;
 
-template <class T>
+template <class T, class = int>
 struct deref_type {
   using type = T;
 };
@@ -203,6 +207,21 @@ struct deref_type<std::weak_ptr<T>> {
   using type = remove_qualifiers_t<typename deref_type<T>::type>;
 };
 
+template <class T, decltype(sizeof(0)) N>
+struct deref_type<poly<T, N>> {
+  using type = remove_qualifiers_t<typename deref_type<T>::type>;
+};
+
+template <class T>
+struct deref_type<borrowed<T>> {
+  using type = remove_qualifiers_t<typename deref_type<T>::type>;
+};
+
+template <class T>
+struct deref_type<T, valid_t<typename smart_ptr_traits<T>::element_type>> {
+  using type = remove_qualifiers_t<typename deref_type<typename smart_ptr_traits<T>::element_type>::type>;
+};
+
 template <class T, class TAllocator>
 struct deref_type<std::vector<T, TAllocator>> {
   using type = core::array<remove_qualifiers_t<typename deref_type<T>::type>>;
@@ -233,10 +252,25 @@ struct is_abstract : integral_constant<bool, __is_abstract(T)> {};
 template <class T>
 struct is_polymorphic : integral_constant<bool, __is_polymorphic(T)> {};
 
+template <class T>
+struct is_empty : integral_constant<bool, __is_empty(T)> {};
+
+template <class T>
+struct is_final : integral_constant<bool, __is_final(T)> {};
+
 template <class...>
 using is_valid_expr = true_type;
 
-#if __has_extension(is_constructible) && !((__clang_major__ == 3) && (__clang_minor__ == 5))  // __pph__
+#if __has_builtin(__is_aggregate) || (defined(__GCC__) && (__GNUC__ >= 7))  // __pph__
+template <class T>
+struct is_aggregate : integral_constant<bool, __is_aggregate(T)> {};
+#else   // __pph__
+template <class>
+struct is_aggregate : false_type {};
+#endif  // __pph__
+
+#if (__has_extension(is_constructible) && !((__clang_major__ == 3) && (__clang_minor__ == 5))) || \
+    (defined(__GCC__) && __has_builtin(__is_constructible))  // __pph__
 template <class T, class... TArgs>
 using is_constructible = integral_constant<bool, __is_constructible(T, TArgs...)>;
 #else   // __pph__
@@ -259,15 +293,27 @@ using is_braces_constructible = decltype(test_is_braces_constructible<T, TArgs..
 template <class T, class... TArgs>
 using is_braces_constructible_t = typename is_braces_constructible<T, TArgs...>::type;
 
+template <class T>
+decltype(void(T(declval<T>())), integral_constant<bool, noexcept(T(declval<T>()))>{}) test_is_nothrow_move_constructible(
+    int);
+template <class>
+false_type test_is_nothrow_move_constructible(...);
+template <class T>
+using is_nothrow_move_constructible = decltype(test_is_nothrow_move_constructible<T>(0));
+
 #if defined(__MSVC__)  // __pph__
 template <class T>
 struct is_copy_constructible : integral_constant<bool, __is_constructible(T, const T&)> {};
 template <class T>
+struct is_move_constructible : integral_constant<bool, __is_constructible(T, T&&)> {};
+template <class T>
 struct is_default_constructible : integral_constant<bool, __is_constructible(T)> {};
 #else   // __pph__
 template <class T>
 using is_copy_constructible = is_constructible<T, const T&>;
 template <class T>
+using is_move_constructible = is_constructible<T, T&&>;
+template <class T>
 using is_default_constructible = is_constructible<T>;
 #endif  // __pph__
 
@@ -316,9 +362,6 @@ false_type is_a_impl(...);
 template <class T, class U>
 struct is_a : decltype(is_a_impl<T, U>(0)) {};
 
-template <class, class...>
-struct is_unique_impl;
-
 template <class...>
 struct not_unique : false_type {
   using type = not_unique;
@@ -329,15 +372,35 @@ struct not_unique<> : true_type {
   using type = not_unique;
 };
 
-template <class T>
-struct is_unique_impl<T> : not_unique<> {};
+template <int, class T>
+struct unique_entry : type<T> {};
+
+template <class, class...>
+struct unique_set;
+
+template <int... Ns, class... Ts>
+struct unique_set<index_sequence<Ns...>, Ts...> : unique_entry<Ns, Ts>... {};
+
+template <class TSet, class T>
+using is_unique_in = is_convertible<TSet*, type<T>*>;  // ambiguous base when T is in the set more than once
+
+template <class>
+struct first_not_unique;
+
+template <class T, class... Ts>
+struct first_not_unique<type_list<T, Ts...>> : not_unique<T> {};
+
+template <class TSet, class... Ts>
+struct get_not_unique
+    : first_not_unique<join_t<conditional_t<is_unique_in<TSet, Ts>::value, type_list<>, type_list<Ts>>...>> {};
 
-template <class T1, class T2, class... Ts>
-struct is_unique_impl<T1, T2, Ts...>
-    : conditional_t<is_base_of<type<T2>, T1>::value, not_unique<T2>, is_unique_impl<inherit<T1, type<T2>>, Ts...>> {};
+template <class TSet, class... Ts>
+struct is_unique_impl
+    : conditional_t<is_same<bool_list<always<Ts>::value...>, bool_list<is_unique_in<TSet, Ts>::value...>>::value, not_unique<>,
+                    get_not_unique<TSet, Ts...>> {};
 
 template <class... Ts>
-using is_unique = is_unique_impl<none_type, Ts...>;
+using is_unique = is_unique_impl<unique_set<make_index_sequence<sizeof...(Ts)>, Ts...>, Ts...>;
 
 template <class, class...>
 struct unique_impl;
@@ -351,7 +414,7 @@ template <class T1, class... Rs>
 struct unique_impl<type<T1, Rs...>> : type_list<Rs...> {};
 
 template <class... Ts>
-struct unique : unique_impl<type<none_type>, Ts...> {};
+struct unique : conditional_t<is_unique<Ts...>::value, type_list<Ts...>, unique_impl<type<none_type>, Ts...>> {};
 
 template <class T>
 struct unique<T> : type_list<T> {};
@@ -366,7 +429,8 @@ struct callable_base_impl {
 };
 
 template <class T>
-struct callable_base : callable_base_impl, aux::conditional_t<aux::is_class<T>::value, T, aux::none_type> {};
+struct callable_base : callable_base_impl,
+                       aux::conditional_t<aux::is_class<T>::value && !aux::is_final<T>::value, T, aux::none_type> {};
 
 template <typename T>
 aux::false_type is_callable_impl(T*, aux::non_type<void (callable_base_impl::*)(...), &T::operator()>* = 0);
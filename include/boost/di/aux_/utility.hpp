@@ -69,32 +69,6 @@ struct inherit : Ts... {
   using type = inherit;
 };
 
-template <class...>
-struct join;
-
-template <>
-struct join<> {
-  using type = type_list<>;
-};
-
-template <class... TArgs>
-struct join<type_list<TArgs...>> {
-  using type = type_list<TArgs...>;
-};
-
-template <class... TArgs1, class... TArgs2>
-struct join<type_list<TArgs1...>, type_list<TArgs2...>> {
-  using type = type_list<TArgs1..., TArgs2...>;
-};
-
-template <class... TArgs1, class... TArgs2, class... Ts>
-struct join<type_list<TArgs1...>, type_list<TArgs2...>, Ts...> {
-  using type = typename join<type_list<TArgs1..., TArgs2...>, Ts...>::type;
-};
-
-template <class... TArgs>
-using join_t = typename join<TArgs...>::type;
-
 template <int...>
 struct index_sequence {
   using type = index_sequence;
@@ -111,46 +85,107 @@ template <int N>
 struct make_index_sequence_impl {
   using type = typename __make_integer_seq<integer_sequence, int, N>::type;
 };
+#elif __has_builtin(__integer_pack) || (__GNUC__ >= 8)  // __pph__
+template <int N>
+struct make_index_sequence_impl {
+  using type = index_sequence<__integer_pack(N)...>;
+};
 #else   // __pph__
-template <int>
-struct make_index_sequence_impl;
+template <class, class>
+struct concat_index_sequence;
+
+template <int... Ns, int... Ms>
+struct concat_index_sequence<index_sequence<Ns...>, index_sequence<Ms...>>
+    : index_sequence<Ns..., (sizeof...(Ns) + Ms)...> {};
+
+template <int N>
+struct make_index_sequence_impl
+    : concat_index_sequence<typename make_index_sequence_impl<N / 2>::type,
+                            typename make_index_sequence_impl<N - N / 2>::type> {};
 
 template <>
 struct make_index_sequence_impl<0> : index_sequence<> {};
 
 template <>
 struct make_index_sequence_impl<1> : index_sequence<0> {};
+#endif  // __pph__
 
-template <>
-struct make_index_sequence_impl<2> : index_sequence<0, 1> {};
+template <int N>
+using make_index_sequence = typename make_index_sequence_impl<N>::type;
 
-template <>
-struct make_index_sequence_impl<3> : index_sequence<0, 1, 2> {};
+template <class...>
+struct join;
 
 template <>
-struct make_index_sequence_impl<4> : index_sequence<0, 1, 2, 3> {};
+struct join<> {
+  using type = type_list<>;
+};
 
-template <>
-struct make_index_sequence_impl<5> : index_sequence<0, 1, 2, 3, 4> {};
+template <class... TArgs>
+struct join<type_list<TArgs...>> {
+  using type = type_list<TArgs...>;
+};
 
-template <>
-struct make_index_sequence_impl<6> : index_sequence<0, 1, 2, 3, 4, 5> {};
+template <class... TArgs1, class... TArgs2>
+struct join<type_list<TArgs1...>, type_list<TArgs2...>> {
+  using type = type_list<TArgs1..., TArgs2...>;
+};
 
-template <>
-struct make_index_sequence_impl<7> : index_sequence<0, 1, 2, 3, 4, 5, 6> {};
+template <int, class T>
+struct join_as {
+  using type = T;
+};
 
-template <>
-struct make_index_sequence_impl<8> : index_sequence<0, 1, 2, 3, 4, 5, 6, 7> {};
+template <class>
+struct join_shift;
 
-template <>
-struct make_index_sequence_impl<9> : index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8> {};
+template <int... Ns>
+struct join_shift<index_sequence<Ns...>> {
+  template <class... Ts>
+  static type_list<Ts...> drop(typename join_as<Ns, const void*>::type..., Ts*...);
 
-template <>
-struct make_index_sequence_impl<10> : index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8, 9> {};
-#endif  // __pph__
+  template <class... Ts>
+  using type = decltype(drop(static_cast<Ts*>(nullptr)..., static_cast<typename join_as<Ns, type_list<>>::type*>(nullptr)...));
+};
 
-template <int N>
-using make_index_sequence = typename make_index_sequence_impl<N>::type;
+template <bool, class, class>
+struct join_pair {
+  using type = type_list<>;
+};
+
+template <class T1, class T2>
+struct join_pair<true, T1, T2> : join<T1, T2> {};
+
+template <bool, int, class...>
+struct join_tree;
+
+template <int Step, class T, class... Ts>
+struct join_tree<false, Step, T, Ts...> {
+  using type = T;
+};
+
+template <int, class, class, class>
+struct join_step;
+
+template <int Step, class... Ts>
+struct join_tree<true, Step, Ts...>
+    : join_step<Step, make_index_sequence<sizeof...(Ts)>, type_list<Ts...>,
+                typename join_shift<make_index_sequence<Step>>::template type<Ts...>> {};
+
+template <int Step, int... Ns, class... Ts, class... TShifted>
+struct join_step<Step, index_sequence<Ns...>, type_list<Ts...>, type_list<TShifted...>>
+    : join_tree<(2 * Step < sizeof...(Ts)), 2 * Step, typename join_pair<Ns % (2 * Step) == 0, Ts, TShifted>::type...> {};
+
+/**
+ * Pairwise reduction, each step joins every list at a multiple of 2 * Step with the one Step further at once
+ * (the shifted lists come from a single deduction), hence the depth of instantiation is logarithmic in the number of lists
+ */
+template <class... TArgs1, class... TArgs2, class... TArgs3, class... Ts>
+struct join<type_list<TArgs1...>, type_list<TArgs2...>, type_list<TArgs3...>, Ts...>
+    : join_tree<true, 1, type_list<TArgs1...>, type_list<TArgs2...>, type_list<TArgs3...>, Ts...> {};
+
+template <class... TArgs>
+using join_t = typename join<TArgs...>::type;
 
 }  // aux
 
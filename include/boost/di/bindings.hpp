@@ -10,8 +10,12 @@
 #include "boost/di/aux_/compiler.hpp"
 #include "boost/di/aux_/utility.hpp"
 #include "boost/di/core/dependency.hpp"
+#include "boost/di/scopes/concurrent_scoped.hpp"
 #include "boost/di/scopes/deduce.hpp"
+#include "boost/di/scopes/injector_singleton.hpp"
+#include "boost/di/scopes/pooled.hpp"
 #include "boost/di/scopes/singleton.hpp"
+#include "boost/di/scopes/thread_local.hpp"
 #include "boost/di/scopes/unique.hpp"
 #include "boost/di/concepts/boundable.hpp"
 
@@ -53,5 +57,9 @@ static constexpr BOOST_DI_UNUSED core::override override{};
 static constexpr BOOST_DI_UNUSED scopes::deduce deduce{};
 static constexpr BOOST_DI_UNUSED scopes::unique unique{};
 static constexpr BOOST_DI_UNUSED scopes::singleton singleton{};
+static constexpr BOOST_DI_UNUSED scopes::injector_singleton injector_singleton{};
+static constexpr BOOST_DI_UNUSED scopes::concurrent_scoped concurrent_scoped{};
+static constexpr BOOST_DI_UNUSED scopes::thread_local_ thread_local_{};
+static constexpr BOOST_DI_UNUSED scopes::pooled pooled{};
 
 #endif
@@ -0,0 +1,32 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_BORROWED_HPP
+#define BOOST_DI_BORROWED_HPP
+
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/fwd.hpp"
+
+template <class T>
+class borrowed {
+ public:
+  borrowed() noexcept = default;
+
+  explicit borrowed(T& object) noexcept : object_(&object) {}
+
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<I*, T*>::value) = 0>
+  borrowed(const borrowed<I>& other) noexcept : object_(other.get()) {}
+
+  T* get() const noexcept { return object_; }
+  T& operator*() const noexcept { return *object_; }
+  T* operator->() const noexcept { return object_; }
+  explicit operator bool() const noexcept { return object_; }
+
+ private:
+  T* object_ = nullptr;
+};
+
+#endif
@@ -59,6 +59,14 @@ struct get_not_supported<T, TDeps...>
     : aux::conditional<aux::is_a<core::injector_base, T>::value || aux::is_a<core::dependency_base, T>::value,
                        typename get_not_supported<TDeps...>::type, T> {};
 
+#if !defined(BOOST_DI_CFG_VALIDATE_BINDINGS) || BOOST_DI_CFG_VALIDATE_BINDINGS  // __pph__
+template <class... Ts>
+using is_unique_bindings = aux::is_unique<Ts...>;
+#else   // __pph__
+template <class...>
+using is_unique_bindings = aux::not_unique<>;
+#endif  // __pph__
+
 template <class>
 struct is_unique;
 
@@ -70,7 +78,7 @@ struct unique_dependency<T, BOOST_DI_REQUIRES(aux::is_a<core::dependency_base, T
     : aux::pair<aux::pair<typename T::expected, typename T::name>, typename T::priority> {};
 
 template <class... TDeps>
-struct is_unique<aux::type_list<TDeps...>> : aux::is_unique<typename unique_dependency<TDeps>::type...> {};
+struct is_unique<aux::type_list<TDeps...>> : is_unique_bindings<typename unique_dependency<TDeps>::type...> {};
 
 template <class>
 struct get_is_unique_error_impl : aux::true_type {};
@@ -95,7 +103,7 @@ struct get_is_unique_error;
 
 template <class... TDeps>
 struct get_is_unique_error<aux::type_list<TDeps...>>
-    : get_is_unique_error_impl<typename aux::is_unique<typename unique_dependency<TDeps>::type...>::type> {};
+    : get_is_unique_error_impl<typename is_unique_bindings<typename unique_dependency<TDeps>::type...>::type> {};
 
 template <class... TDeps>
 using boundable_bindings =
@@ -169,7 +177,7 @@ auto boundable_impl(concepts::any_of<Ts...>&&, T && )
 
 template <class... TDeps>  // make_injector
 auto boundable_impl(aux::type<TDeps...> && ) ->
-    typename get_is_unique_error_impl<typename aux::is_unique<TDeps...>::type>::type;
+    typename get_is_unique_error_impl<typename is_unique_bindings<TDeps...>::type>::type;
 
 aux::true_type boundable_impl(...);
 
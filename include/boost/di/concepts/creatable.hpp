@@ -151,7 +151,7 @@ template <class... TCtor>
 struct ctor_size<aux::type_list<TCtor...>> : aux::integral_constant<int, sizeof...(TCtor)> {};
 
 template <class T>
-using ctor_size_t = ctor_size<typename type_traits::ctor<T, type_traits::ctor_impl_t<aux::is_constructible, T>>::type>;
+using ctor_size_t = ctor_size<typename type_traits::ctor<T, type_traits::ctor_args_t<T>>::type>;
 
 template <class TInitialization, class TName, class _, class TCtor, class T = aux::decay_t<_>>
 struct creatable_error_impl
@@ -160,7 +160,7 @@ struct creatable_error_impl
           aux::conditional_t<aux::is_same<TName, no_name>::value, typename abstract_type<T>::is_not_bound,
                              typename abstract_type<T>::template named<TName>::is_not_bound>,
           aux::conditional_t<ctor_size_t<T>::value == ctor_size<TCtor>::value,
-                             typename type<T>::has_to_many_constructor_parameters::template max<BOOST_DI_CFG_CTOR_LIMIT_SIZE>,
+                             typename type<T>::has_to_many_constructor_parameters::template max<ctor_limit<T>::value>,
                              typename type<T>::has_ambiguous_number_of_constructor_parameters::template given<
                                  ctor_size<TCtor>::value>::template expected<ctor_size_t<T>::value>>> {};
 
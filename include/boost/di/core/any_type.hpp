@@ -13,31 +13,34 @@
 
 namespace core {
 
-template <class T, class TInjector, class TError = aux::false_type>
+template <class T, class TInjector, class TParent, class TError = aux::false_type>
 struct is_referable__ {
-  static constexpr auto value = dependency__<binder::resolve_t<TInjector, T>>::template is_referable<T>::value;
+  using dependency_t = binder::resolve_t<TInjector, T, no_name, dependency<scopes::deduce, aux::decay_t<T>>, TParent>;
+  static constexpr auto value = dependency__<dependency_t>::template is_referable<T>::value;
 };
 
-template <class T, class TInjector>
-struct is_referable__<T, TInjector, aux::true_type> {
+template <class T, class TInjector, class TParent>
+struct is_referable__<T, TInjector, TParent, aux::true_type> {
   static constexpr auto value = true;
 };
 
-template <class T, class TInjector, class TError>
+template <class T, class TInjector, class TParent, class TError>
 struct is_creatable__ {
-  static constexpr auto value = injector__<TInjector>::template is_creatable<T>::value;
+  static constexpr auto value = injector__<TInjector>::template is_creatable<T, no_name, aux::false_type, TParent>::value;
 };
 
-template <class T, class TInjector>
-struct is_creatable__<T, TInjector, aux::false_type> {
+template <class T, class TInjector, class TParent>
+struct is_creatable__<T, TInjector, TParent, aux::false_type> {
   static constexpr auto value = true;
 };
 
 template <class TParent, class TInjector, class TError = aux::false_type>
 struct any_type {
-  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
+  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -45,29 +48,31 @@ struct any_type {
 
 template <class TParent, class TInjector, class TError = aux::false_type, class TRefError = aux::false_type>
 struct any_type_ref {
-  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
+  template <class T, class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
 #if defined(__GCC__)  // __pph__
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, TError>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, context_t, TError>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif  // __pph__
 
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, TError>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, context_t, TError>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
 
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, TError>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, context_t, TError>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -75,10 +80,12 @@ struct any_type_ref {
 
 template <class TParent, class TInjector, class TError = aux::false_type>
 struct any_type_1st {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -86,33 +93,35 @@ struct any_type_1st {
 
 template <class TParent, class TInjector, class TError = aux::false_type, class TRefError = aux::false_type>
 struct any_type_1st_ref {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_creatable__<T, TInjector, context_t, TError>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
 #if defined(__GCC__)  // __pph__
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&&, TInjector, context_t, TError>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif  // __pph__
 
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<T&, TInjector, context_t, TError>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
 
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, TRefError>::value),
-            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, TError>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t, TRefError>::value),
+            class = BOOST_DI_REQUIRES(is_creatable__<const T&, TInjector, context_t, TError>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_).create_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -122,9 +131,12 @@ namespace successful {
 
 template <class TParent, class TInjector>
 struct any_type {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
   template <class T>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -132,26 +144,32 @@ struct any_type {
 
 template <class TParent, class TInjector>
 struct any_type_ref {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
   template <class T>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
 #if defined(__GCC__)  // __pph__
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif  // __pph__
 
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
 
-  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector>::value)>
+  template <class T, class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -159,9 +177,12 @@ struct any_type_ref {
 
 template <class TParent, class TInjector>
 struct any_type_1st {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -169,29 +190,35 @@ struct any_type_1st {
 
 template <class TParent, class TInjector>
 struct any_type_1st_ref {
+  using context_t = typename injector__<TInjector>::template context_t<TParent>;
+
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value)>
   operator T() {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T>{}, aux::type<context_t>{});
   }
 
 #if defined(__GCC__)  // __pph__
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&&, TInjector, context_t>::value)>
   operator T &&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&&>{}, aux::type<context_t>{});
   }
 #endif  // __pph__
 
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<T&, TInjector, context_t>::value)>
   operator T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<T&>{}, aux::type<context_t>{});
   }
 
   template <class T, class = BOOST_DI_REQUIRES(!aux::is_convertible<TParent, T>::value),
-            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector>::value)>
+            class = BOOST_DI_REQUIRES(is_referable__<const T&, TInjector, context_t>::value)>
   operator const T&() const {
-    return static_cast<const core::injector__<TInjector>&>(injector_).create_successful_impl(aux::type<const T&>{});
+    return static_cast<const core::injector__<TInjector>&>(injector_)
+        .create_successful_impl(aux::type<const T&>{}, aux::type<context_t>{});
   }
 
   const TInjector& injector_;
@@ -31,21 +31,52 @@ class binder {
     return static_cast<dependency<TScope, TExpected, TGiven, TName, override>&>(*dep);
   }
 
-  template <class TDeps, class T, class TName, class TDefault>
+  template <class TDeps, class TContext>
+  using is_bound = aux::integral_constant<
+      bool, !aux::is_same<decltype(resolve_impl<aux::none_type, TContext>((TDeps*)0)), aux::none_type>::value>;
+
+  template <class TDefault, class TDependency, class TContext, class TDeps>
+  static decltype(auto) resolve_context(TDeps* deps, const aux::false_type&) noexcept {
+    return resolve_impl<TDefault, TDependency>(deps);
+  }
+
+  template <class TDefault, class TDependency, class TContext, class TDeps>
+  static decltype(auto) resolve_context(TDeps* deps, const aux::true_type&) noexcept {
+    return resolve_impl<TDefault, TContext>(deps);
+  }
+
+  template <class TDeps, class TContext, class TParent>
+  struct is_contextual : is_bound<TDeps, TContext> {};
+
+  template <class TDeps, class TContext>
+  struct is_contextual<TDeps, TContext, aux::none_type> : aux::false_type {};
+
+  template <class TDeps, class T, class TName, class TDefault, class TParent>
   struct resolve__ {
     using dependency = dependency_concept<aux::decay_t<T>, TName>;
-    using type = aux::remove_reference_t<decltype(resolve_impl<TDefault, dependency>((TDeps*)0))>;
+    using context = dependency_concept<aux::decay_t<T>, contextual<TParent, TName>>;
+    using type = aux::remove_reference_t<decltype(
+        resolve_context<TDefault, dependency, context>((TDeps*)0, is_bound<TDeps, context>{}))>;
+  };
+
+  template <class TDeps, class T, class TName, class TDefault>
+  struct resolve__<TDeps, T, TName, TDefault, aux::none_type> {
+    using type = aux::remove_reference_t<decltype(
+        resolve_impl<TDefault, dependency_concept<aux::decay_t<T>, TName>>((TDeps*)0))>;
   };
 
  public:
-  template <class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>, class TDeps>
+  template <class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>,
+            class TParent = aux::none_type, class TDeps>
   static decltype(auto) resolve(TDeps* deps) noexcept {
     using dependency = dependency_concept<aux::decay_t<T>, TName>;
-    return resolve_impl<TDefault, dependency>(deps);
+    using context = dependency_concept<aux::decay_t<T>, contextual<TParent, TName>>;
+    return resolve_context<TDefault, dependency, context>(deps, is_contextual<TDeps, context, TParent>{});
   }
 
-  template <class TDeps, class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>>
-  using resolve_t = typename resolve__<TDeps, T, TName, TDefault>::type;
+  template <class TDeps, class T, class TName = no_name, class TDefault = dependency<scopes::deduce, aux::decay_t<T>>,
+            class TParent = aux::none_type>
+  using resolve_t = typename resolve__<TDeps, T, TName, TDefault, TParent>::type;
 };
 
 }  // core
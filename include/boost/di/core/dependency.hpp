@@ -21,6 +21,15 @@ namespace core {
 template <class, class>
 struct dependency_concept {};
 
+template <class, class>
+struct contextual {};
+
+template <class>
+struct is_contextual : aux::false_type {};
+
+template <class TParent, class TName>
+struct is_contextual<contextual<TParent, TName>> : aux::true_type {};
+
 template <class T, class TDependency>
 struct dependency_impl : aux::pair<T, TDependency> {};
 
@@ -107,6 +116,11 @@ class dependency
     return dependency<TScope, TExpected, TGiven, T, TPriority>{static_cast<dependency&&>(*this)};
   }
 
+  template <class T, BOOST_DI_REQUIRES(!aux::is_same<T, aux::none_type>::value) = 0>
+  auto when() noexcept {
+    return dependency<TScope, TExpected, TGiven, contextual<T, TName>, TPriority>{static_cast<dependency&&>(*this)};
+  }
+
   template <class T, BOOST_DI_REQUIRES_MSG(concepts::scopable<T>) = 0>
   auto in(const T&) noexcept {
     return dependency<T, TExpected, TGiven, TName, TPriority>{};
@@ -139,6 +153,13 @@ class dependency
     return dependency{static_cast<T&&>(object)};
   }
 
+  template <class T, class TSelector, BOOST_DI_REQUIRES(aux::is_same<TExpected, T>::value) = 0,
+            class TCreate = typename T::template selector<TSelector>>
+  auto to(const TSelector& selector) noexcept {
+    using dependency = dependency<scopes::instance, TExpected, TCreate, TName, TPriority>;
+    return dependency{TCreate{selector}};
+  }
+
   template <class...>
   dependency& to(...) const noexcept;
 
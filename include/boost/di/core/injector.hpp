@@ -14,6 +14,7 @@
 #include "boost/di/aux_/utility.hpp"
 #include "boost/di/core/any_type.hpp"
 #include "boost/di/core/binder.hpp"
+#include "boost/di/core/objects.hpp"
 #include "boost/di/core/policy.hpp"
 #include "boost/di/core/pool.hpp"
 #include "boost/di/core/provider.hpp"
@@ -31,6 +32,14 @@ struct from_deps {};
 struct init {};
 struct with_error {};
 
+template <class, class>
+constexpr bool is_extern_create = false;  // specialized by BOOST_DI_EXTERN_CREATE
+
+template <class TInjector, class T>
+struct extern_create : aux::integral_constant<bool, is_extern_create<TInjector, T>> {
+  static T create(const TInjector&);  // specialized by BOOST_DI_EXTERN_CREATE, defined by BOOST_DI_INSTANTIATE_CREATE
+};
+
 template <class>
 struct copyable;
 
@@ -71,6 +80,18 @@ struct referable<T&&, TDependency> {
 template <class T, class TDependency>
 using referable_t = typename referable<T, TDependency>::type;
 
+template <class>
+struct has_contextual;
+
+template <class... TDeps>
+struct has_contextual<aux::type_list<TDeps...>>
+    : aux::integral_constant<bool, !aux::is_same<aux::bool_list<aux::always<TDeps>::value...>,
+                                                 aux::bool_list<!is_contextual<typename TDeps::name>::value...>>::value> {};
+
+template <class TDependency>
+struct is_placeable : aux::integral_constant<bool, aux::is_same<typename TDependency::scope, scopes::deduce>::value ||
+                                                       aux::is_same<typename TDependency::scope, scopes::unique>::value> {};
+
 #if defined(__MSVC__)  // __pph__
 template <class T, class TInjector>
 inline auto build(TInjector&& injector) noexcept {
@@ -90,12 +111,21 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
   friend class binder;
   template <class>
   friend struct pool;
+  template <class, class>
+  friend struct extern_create;
   using pool_t = pool<bindings_t<TDeps...>>;
 
  protected:
-  template <class T, class TName = no_name, class TIsRoot = aux::false_type>
+  /**
+   * Type being constructed, used to resolve `when<TParent>()` bindings.
+   * Without contextual bindings it's dropped, so that lookups and instantiations are shared between parents
+   */
+  template <class TParent>
+  using context_t = aux::conditional_t<has_contextual<bindings_t<TDeps...>>::value, TParent, aux::none_type>;
+
+  template <class T, class TName = no_name, class TIsRoot = aux::false_type, class TParent = aux::none_type>
   struct is_creatable {
-    using dependency_t = binder::resolve_t<injector, T, TName>;
+    using dependency_t = binder::resolve_t<injector, T, TName, dependency<scopes::deduce, aux::decay_t<T>>, TParent>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using ctor_args_t = typename ctor_t::second::second;
 
@@ -112,6 +142,9 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
   using deps = bindings_t<TDeps...>;
   using config = TConfig;
 
+  template <class T>
+  using storage_t = type_traits::placement::storage<typename binder::resolve_t<injector, T>::given>;
+
   injector(injector && ) = default;
 
   template <class... TArgs>
@@ -121,12 +154,19 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
   explicit injector(injector<TConfig_, TPolicies_, TDeps_...> && other) noexcept
       : injector{from_injector{}, static_cast<injector<TConfig_, TPolicies_, TDeps_...>&&>(other), deps{}} {}
 
-  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  template <class T, BOOST_DI_REQUIRES(extern_create<injector, T>::value) = 0>
+  T create() const {
+    return extern_create<injector, T>::create(*this);
+  }
+
+  template <class T, BOOST_DI_REQUIRES(aux::conditional_t<extern_create<injector, T>::value, aux::false_type,
+                                                          is_creatable<T, no_name, aux::true_type>>::value) = 0>
   T create() const {
     return BOOST_DI_TYPE_WKND(T) create_successful_impl<aux::true_type>(aux::type<T>{});
   }
 
-  template <class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, aux::true_type>::value) = 0>
+  template <class T, BOOST_DI_REQUIRES(!aux::conditional_t<extern_create<injector, T>::value, aux::true_type,
+                                                           is_creatable<T, no_name, aux::true_type>>::value) = 0>
   BOOST_DI_CONCEPTS_CREATABLE_ERROR_MSG T
       // clang-format off
   create
@@ -135,104 +175,148 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     return BOOST_DI_TYPE_WKND(T) create_impl<aux::true_type>(aux::type<T>{});
   }
 
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  objects<T> create_n(decltype(sizeof(0)) size) const {
+    return objects<T>{size, [this](void* memory, decltype(sizeof(0)) size, decltype(sizeof(0))& created) {
+                        create_n_impl__<T>(memory, size, created);
+                      }};
+  }
+
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  T* create_into(void* memory, decltype(sizeof(0)) size) const {
+    struct rollback {
+      ~rollback() noexcept {
+        while (created) {
+          static_cast<T*>(memory)[--created].~T();
+        }
+      }
+      void* memory;
+      decltype(sizeof(0)) created;
+    } guard{memory, 0};
+    create_n_impl__<T>(memory, size, guard.created);
+    guard.created = 0;
+    return &static_cast<typename objects<T>::element*>(memory)->object;
+  }
+
+  template <class T, BOOST_DI_REQUIRES(aux::conditional_t<is_placeable<binder::resolve_t<injector, T>>::value,
+                                                          is_creatable<T*, no_name, aux::true_type>,
+                                                          aux::false_type>::value) = 0>
+  T& create_at(void* memory) const {
+    return *create_at_impl__<T>(memory);
+  }
+
  protected:
-  template <class T>
+  template <class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, aux::true_type>::value) = 0>
+  T create_extern__() const {
+    return BOOST_DI_TYPE_WKND(T) create_successful_impl<aux::true_type>(aux::type<T>{});
+  }
+
+  template <class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, aux::true_type>::value) = 0>
+  BOOST_DI_CONCEPTS_CREATABLE_ERROR_MSG T
+      // clang-format off
+  create_extern__
+      // clang-format on
+      () const {
+    return BOOST_DI_TYPE_WKND(T) create_impl<aux::true_type>(aux::type<T>{});
+  }
+
+  template <class T, class TParent = aux::none_type>
   struct try_create {
-    using type = aux::conditional_t<is_creatable<T>::value, T, void>;
+    using type = aux::conditional_t<is_creatable<T, no_name, aux::false_type, TParent>::value, T, void>;
   };
 
-  template <class TParent>
-  struct try_create<any_type_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_fwd<TParent>, _> {
     using type = any_type<TParent, injector, with_error>;
   };
 
-  template <class TParent>
-  struct try_create<any_type_ref_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_ref_fwd<TParent>, _> {
     using type = any_type_ref<TParent, injector, with_error>;
   };
 
-  template <class TParent>
-  struct try_create<any_type_1st_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_1st_fwd<TParent>, _> {
     using type = any_type_1st<TParent, injector, with_error>;
   };
 
-  template <class TParent>
-  struct try_create<any_type_1st_ref_fwd<TParent>> {
+  template <class TParent, class _>
+  struct try_create<any_type_1st_ref_fwd<TParent>, _> {
     using type = any_type_1st_ref<TParent, injector, with_error>;
   };
 
-  template <class TName, class T>
-  struct try_create<BOOST_DI_NAMESPACE::named<TName, T>> {
-    using type = aux::conditional_t<is_creatable<T, TName>::value, T, void>;
+  template <class TName, class T, class TParent>
+  struct try_create<BOOST_DI_NAMESPACE::named<TName, T>, TParent> {
+    using type = aux::conditional_t<is_creatable<T, TName, aux::false_type, TParent>::value, T, void>;
   };
 
-  template <class T>
-  struct try_create<self<T>> {
+  template <class T, class _>
+  struct try_create<self<T>, _> {
     using type = injector;
   };
 
-  template <class TIsRoot = aux::false_type, class T>
-  auto create_impl(const aux::type<T>&)const {
-    return create_impl__<TIsRoot, T>();
+  template <class TIsRoot = aux::false_type, class T, class TParent = aux::none_type>
+  auto create_impl(const aux::type<T>&, const aux::type<TParent>& = {})const {
+    return create_impl__<TIsRoot, T, no_name, TParent>();
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_fwd<TParent>>&, const aux::type<_>& = {})const {
     return any_type<TParent, injector>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_ref_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_ref_fwd<TParent>>&, const aux::type<_>& = {})const {
     return any_type_ref<TParent, injector, aux::false_type, aux::true_type>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_1st_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_1st_fwd<TParent>>&, const aux::type<_>& = {})const {
     return any_type_1st<TParent, injector>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&, const aux::type<_>& = {})const {
     return any_type_1st_ref<TParent, injector, aux::false_type, aux::true_type>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class T, class TName>
-  auto create_impl(const aux::type<BOOST_DI_NAMESPACE::named<TName, T>>&)const {
-    return create_impl__<TIsRoot, T, TName>();
+  template <class TIsRoot = aux::false_type, class T, class TName, class TParent = aux::none_type>
+  auto create_impl(const aux::type<BOOST_DI_NAMESPACE::named<TName, T>>&, const aux::type<TParent>& = {})const {
+    return create_impl__<TIsRoot, T, TName, TParent>();
   }
 
-  template <class TIsRoot = aux::false_type, class T>
-  auto create_successful_impl(const aux::type<T>&)const {
-    return create_successful_impl__<TIsRoot, T>();
+  template <class TIsRoot = aux::false_type, class T, class TParent = aux::none_type>
+  auto create_successful_impl(const aux::type<T>&, const aux::type<TParent>& = {})const {
+    return create_successful_impl__<TIsRoot, T, no_name, TParent>();
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&, const aux::type<_>& = {})const {
     return successful::any_type<TParent, injector>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&, const aux::type<_>& = {})const {
     return successful::any_type_ref<TParent, injector>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_1st_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_1st_fwd<TParent>>&, const aux::type<_>& = {})const {
     return successful::any_type_1st<TParent, injector>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class TParent>
-  auto create_successful_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&)const {
+  template <class TIsRoot = aux::false_type, class TParent, class _ = aux::none_type>
+  auto create_successful_impl(const aux::type<any_type_1st_ref_fwd<TParent>>&, const aux::type<_>& = {})const {
     return successful::any_type_1st_ref<TParent, injector>{*this};
   }
 
-  template <class TIsRoot = aux::false_type, class T, class TName>
-  auto create_successful_impl(const aux::type<BOOST_DI_NAMESPACE::named<TName, T>>&)const {
-    return create_successful_impl__<TIsRoot, T, TName>();
+  template <class TIsRoot = aux::false_type, class T, class TName, class TParent = aux::none_type>
+  auto create_successful_impl(const aux::type<BOOST_DI_NAMESPACE::named<TName, T>>&, const aux::type<TParent>& = {})const {
+    return create_successful_impl__<TIsRoot, T, TName, TParent>();
   }
 
-  template <class TIsRoot = aux::false_type, class T>
-  decltype(auto) create_successful_impl(const aux::type<self<T>>&)const {
+  template <class TIsRoot = aux::false_type, class T, class _ = aux::none_type>
+  decltype(auto) create_successful_impl(const aux::type<self<T>>&, const aux::type<_>& = {})const {
     return *this;
   }
 
@@ -254,9 +338,9 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
 #endif  // __pph__
   {}
 
-  template <class TIsRoot = aux::false_type, class T, class TName = no_name>
+  template <class TIsRoot = aux::false_type, class T, class TName = no_name, class TParent = aux::none_type>
   auto create_impl__() const {
-    auto&& dependency = binder::resolve<T, TName>((injector*)this);
+    auto&& dependency = binder::resolve<T, TName, core::dependency<scopes::deduce, aux::decay_t<T>>, TParent>((injector*)this);
     using dependency_t = aux::remove_reference_t<decltype(dependency)>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using provider_t = core::provider<ctor_t, TName, injector>;
@@ -268,9 +352,9 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     return wrapper<T, wrapper_t>{static_cast<dependency__<dependency_t>&>(dependency).template create<T, TName>(provider_t{this})};
   }
 
-  template <class TIsRoot = aux::false_type, class T, class TName = no_name>
+  template <class TIsRoot = aux::false_type, class T, class TName = no_name, class TParent = aux::none_type>
   auto create_successful_impl__() const {
-    auto&& dependency = binder::resolve<T, TName>((injector*)this);
+    auto&& dependency = binder::resolve<T, TName, core::dependency<scopes::deduce, aux::decay_t<T>>, TParent>((injector*)this);
     using dependency_t = aux::remove_reference_t<decltype(dependency)>;
     using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
     using provider_t = successful::provider<ctor_t, injector>;
@@ -282,6 +366,35 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
         policy::template call<arg_wrapper<T, TName, TIsRoot, ctor_args_t, dependency_t, pool_t>>(TConfig::policies(this));)()
     return successful::wrapper<create_t, wrapper_t>{static_cast<dependency__<dependency_t>&>(dependency).template create<T, TName>(provider_t{this})};
   }
+
+  template <class T>
+  void create_n_impl__(void* memory, decltype(sizeof(0)) size, decltype(sizeof(0))& created) const {
+    auto&& dependency = binder::resolve<T, no_name>((injector*)this);
+    using dependency_t = aux::remove_reference_t<decltype(dependency)>;
+    using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T>::type;
+    using provider_t = successful::provider<ctor_t, injector>;
+    using wrapper_t =
+        decltype(static_cast<dependency__<dependency_t>&>(dependency).template create<T, no_name>(provider_t{this}));
+    using element_t = typename objects<T>::element;
+    BOOST_DI_CORE_INJECTOR_POLICY(
+      using ctor_args_t = typename ctor_t::second::second;
+        policy::template call<arg_wrapper<T, no_name, aux::true_type, ctor_args_t, dependency_t, pool_t>>(TConfig::policies(this));)()
+    for (; created < size; ++created) {
+      new (static_cast<element_t*>(memory) + created) element_t{BOOST_DI_TYPE_WKND(T) successful::wrapper<T, wrapper_t>{
+          static_cast<dependency__<dependency_t>&>(dependency).template create<T, no_name>(provider_t{this})}};
+    }
+  }
+
+  template <class T>
+  T* create_at_impl__(void* memory) const {
+    using dependency_t = binder::resolve_t<injector, T>;
+    using ctor_t = typename type_traits::ctor_traits__<typename dependency_t::given, T*>::type;
+    using provider_t = successful::provider<ctor_t, injector>;
+    BOOST_DI_CORE_INJECTOR_POLICY(
+      using ctor_args_t = typename ctor_t::second::second;
+        policy::template call<arg_wrapper<T*, no_name, aux::true_type, ctor_args_t, dependency_t, pool_t>>(TConfig::policies(this));)()
+    return provider_t{this}.get(type_traits::placement{memory});
+  }
 };
 
 #if defined(BOOST_DI_INJECTOR_ITERATE)
@@ -292,6 +405,12 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
 #define BOOST_DI_CORE_INJECTOR_POLICY(...) BOOST_DI_CORE_INJECTOR_POLICY_ELSE
 #define BOOST_DI_CORE_INJECTOR_POLICY_ELSE(...) __VA_ARGS__
 #include "boost/di/core/injector.hpp"
+
+template <class TConfig, class TPolicies, class... TDeps>
+injector<TConfig, TPolicies, TDeps...> injector_type(const injector<TConfig, TPolicies, TDeps...>&);
+
+template <class TInjector>
+using injector_t = decltype(injector_type(aux::declval<const TInjector&>()));
 }  // core
 #endif
 
@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_CORE_OBJECTS_HPP
+#define BOOST_DI_CORE_OBJECTS_HPP
+
+namespace core {
+
+template <class T>
+class objects {
+  struct storage {
+    alignas(T) unsigned char data[sizeof(T)];
+  };
+
+ public:
+  using size_type = decltype(sizeof(0));
+
+  struct element {
+    static void* operator new(size_type, void* ptr) noexcept { return ptr; }
+    static void operator delete(void*, void*) noexcept {}
+    T object;
+  };
+
+  template <class TCreate>
+  objects(size_type size, const TCreate& create) : objects(reinterpret_cast<T*>(new storage[size])) {
+    create(static_cast<void*>(data_), size, size_);  // constructed by now, a throwing create destroys the created objects
+  }
+
+  objects(objects&& other) noexcept : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+
+  objects(const objects&) = delete;
+  objects& operator=(const objects&) = delete;
+
+  ~objects() noexcept {
+    while (size_) {
+      data_[--size_].~T();
+    }
+    delete[] reinterpret_cast<storage*>(data_);
+  }
+
+  T* begin() const noexcept { return data_; }
+  T* end() const noexcept { return data_ + size_; }
+  T* data() const noexcept { return data_; }
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return !size_; }
+  T& operator[](size_type i) const noexcept { return data_[i]; }
+
+ private:
+  explicit objects(T* data) noexcept : data_(data) {}
+
+  T* data_ = nullptr;
+  size_type size_ = 0;
+};
+
+}  // core
+
+#endif
@@ -34,7 +34,8 @@ struct try_provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, T
   struct is_creatable {
     static constexpr auto value =
         TProvider::template is_creatable<TInitialization, T,
-                                         typename injector__<TInjector>::template try_create<TCtor>::type...>::value;
+                                         typename injector__<TInjector>::template try_create<
+                                             TCtor, typename injector__<TInjector>::template context_t<T>>::type...>::value;
   };
 
   template <class TMemory = type_traits::heap>
@@ -50,6 +51,7 @@ template <class T, class TName, class TInjector, class TInitialization, template
 struct provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, TName, TInjector> {
   using provider_t = decltype(TInjector::config::provider((TInjector*)0));
   using injector_t = TInjector;
+  using context_t = aux::type<typename injector__<TInjector>::template context_t<T>>;
 
   template <class, class... TArgs>
   struct is_creatable {
@@ -58,7 +60,8 @@ struct provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, TName
 
   template <class TMemory = type_traits::heap>
   auto get(const TMemory& memory = {}) const {
-    return get_impl(memory, static_cast<const injector__<TInjector>*>(injector_)->create_impl(aux::type<TCtor>{})...);
+    return get_impl(memory,
+                    static_cast<const injector__<TInjector>*>(injector_)->create_impl(aux::type<TCtor>{}, context_t{})...);
   }
 
   template <class TMemory, class... TArgs, BOOST_DI_REQUIRES(is_creatable<TMemory, TArgs...>::value) = 0>
@@ -82,6 +85,28 @@ struct provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, TName
   const TInjector* injector_;
 };
 
+/**
+ * Provider constructs in place only when it spells out type_traits::placement,
+ * a provider accepting any memory (ex. returning `new T`) is bypassed
+ */
+template <class TProvider, class T, class TInitialization, class... TArgs>
+class is_placement_provider {
+  struct any_memory {};
+
+  template <class TMemory>
+  static decltype(aux::declval<TProvider>().template get<T>(TInitialization{}, aux::declval<TMemory>(),
+                                                             aux::declval<TArgs>()...),
+                  aux::true_type{})
+  test(int);
+
+  template <class>
+  static aux::false_type test(...);
+
+ public:
+  static constexpr auto value =
+      decltype(test<type_traits::placement>(0))::value && !decltype(test<any_memory>(0))::value;
+};
+
 namespace successful {
 
 template <class, class>
@@ -90,12 +115,39 @@ struct provider;
 template <class T, class TInjector, class TInitialization, template <class...> class TList, class... TCtor>
 struct provider<aux::pair<T, aux::pair<TInitialization, TList<TCtor...>>>, TInjector> {
   using injector_t = TInjector;
+  using context_t = aux::type<typename injector__<TInjector>::template context_t<T>>;
 
   template <class TMemory = type_traits::heap>
   auto get(const TMemory& memory = {}) const {
     return TInjector::config::provider(injector_)
         .template get<T>(TInitialization{}, memory,
-                         static_cast<const injector__<TInjector>*>(injector_)->create_successful_impl(aux::type<TCtor>{})...);
+                         static_cast<const injector__<TInjector>*>(injector_)
+                             ->create_successful_impl(aux::type<TCtor>{}, context_t{})...);
+  }
+
+  auto get(const type_traits::placement& memory) const {
+    return get_placement(memory, static_cast<const injector__<TInjector>*>(injector_)
+                                     ->create_successful_impl(aux::type<TCtor>{}, context_t{})...);
+  }
+
+  template <class... TArgs>
+  auto get_placement(const type_traits::placement& memory, TArgs&&... args) const {
+    return get_placement_impl(
+        memory, aux::integral_constant<bool, is_placement_provider<decltype(TInjector::config::provider(injector_)), T,
+                                                                   TInitialization, TArgs...>::value>{},
+        static_cast<TArgs&&>(args)...);
+  }
+
+  template <class... TArgs>
+  auto get_placement_impl(const type_traits::placement& memory, const aux::true_type&, TArgs&&... args) const {
+    return TInjector::config::provider(injector_).template get<T>(TInitialization{}, memory, static_cast<TArgs&&>(args)...);
+  }
+
+  template <class... TArgs>
+  auto get_placement_impl(const type_traits::placement& memory, const aux::false_type&, TArgs&&... args) const {
+    using object_t = aux::conditional_t<aux::is_same<TInitialization, type_traits::direct>::value,
+                                        type_traits::placement::direct<T>, type_traits::placement::uniform<T>>;
+    return &(new (memory.memory) object_t(static_cast<TArgs&&>(args)...))->object;
   }
 
   const TInjector* injector_;
@@ -20,6 +20,20 @@ struct ctor_traits;
 template <class>
 struct self {};
 
+template <class, decltype(sizeof(0))>
+class poly;
+
+template <class>
+class borrowed;
+
+template <class>
+struct smart_ptr_traits {};
+
+template <class T>
+struct smart_ptr_traits<boost::intrusive_ptr<T>> {
+  using element_type = T;
+};
+
 struct ignore_policies {};
 
 namespace core {
@@ -51,8 +65,11 @@ struct injector__ : T {
 #if defined(__MSVC__)  // __pph__
   template <class... Ts>
   using is_creatable = typename T::template is_creatable<Ts...>;
+  template <class TParent>
+  using context_t = typename T::template context_t<TParent>;
 #else   // __pph__
   using T::is_creatable;
+  using T::context_t;
 #endif  // __pph__
 };
 
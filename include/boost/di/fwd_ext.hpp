@@ -18,12 +18,16 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 namespace std {
 #endif  // __pph__
 template <class>
+class allocator;
+template <class>
 class shared_ptr;
 template <class>
 class weak_ptr;
 template <class, class>
 class unique_ptr;
 template <class>
+struct default_delete;
+template <class>
 struct char_traits;
 template <class...>
 class tuple;
@@ -46,6 +50,8 @@ class initializer_list;
 namespace boost {
 template <class>
 class shared_ptr;
+template <class>
+class intrusive_ptr;
 }  // boost
 
 #endif
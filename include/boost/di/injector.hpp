@@ -68,6 +68,9 @@ using injector = detail::injector<
 #define BOOST_DI_EXPOSE_IMPL__(...) decltype(BOOST_DI_NAMESPACE::detail::__VA_ARGS__), // __pph__
 #define BOOST_DI_EXPOSE_IMPL(...) BOOST_DI_NAMESPACE::named<BOOST_DI_EXPOSE_IMPL__ __VA_ARGS__> // __pph__
 #define BOOST_DI_EXPOSE(...) BOOST_DI_IF(BOOST_DI_IBP(__VA_ARGS__), BOOST_DI_EXPOSE_IMPL, BOOST_DI_EXPAND)(__VA_ARGS__) // __pph__
+
+#define BOOST_DI_EXTERN_CREATE(TInjector, ...) template <> constexpr bool BOOST_DI_NAMESPACE::core::is_extern_create<BOOST_DI_NAMESPACE::core::injector_t<TInjector>, __VA_ARGS__> = true; template <> auto BOOST_DI_NAMESPACE::core::extern_create<BOOST_DI_NAMESPACE::core::injector_t<TInjector>, __VA_ARGS__>::create(const BOOST_DI_NAMESPACE::core::injector_t<TInjector>&) -> __VA_ARGS__ // __pph__
+#define BOOST_DI_INSTANTIATE_CREATE(TInjector, ...) template <> auto BOOST_DI_NAMESPACE::core::extern_create<BOOST_DI_NAMESPACE::core::injector_t<TInjector>, __VA_ARGS__>::create(const BOOST_DI_NAMESPACE::core::injector_t<TInjector>& injector) -> __VA_ARGS__ { return injector.template create_extern__<__VA_ARGS__>(); } // __pph__
 // clang-format on
 
 #endif
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_ONE_OF_HPP
+#define BOOST_DI_ONE_OF_HPP
+
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/aux_/utility.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/fwd.hpp"
+
+#if !defined(BOOST_DI_ASSERT)                                                // __pph__
+#if defined(__MSVC__)                                                        // __pph__
+#define BOOST_DI_ASSERT(...) ((__VA_ARGS__) ? (void)0 : __debugbreak())     // __pph__
+#else                                                                        // __pph__
+#define BOOST_DI_ASSERT(...) ((__VA_ARGS__) ? (void)0 : __builtin_trap())  // __pph__
+#endif                                                                       // __pph__
+#endif                                                                       // __pph__
+
+template <class... Ts>
+class one_of {
+  template <decltype(sizeof(0))...>
+  struct max;
+
+  template <decltype(sizeof(0)) N>
+  struct max<N> : aux::integral_constant<decltype(sizeof(0)), N> {};
+
+  template <decltype(sizeof(0)) N, decltype(sizeof(0)) M, decltype(sizeof(0))... Ns>
+  struct max<N, M, Ns...> : max<(N > M ? N : M), Ns...> {};
+
+  struct storage {
+    alignas(max<alignof(Ts)...>::value) unsigned char data[max<sizeof(Ts)...>::value];
+  };
+
+  template <class T, class...>
+  struct first {
+    using type = T;
+  };
+
+  template <class T, class TInjector>
+  static void create(void* memory, const TInjector& injector) {
+    injector.template create_at<T>(memory);
+  }
+
+  template <class T>
+  static void move(void* object, void* memory) noexcept(aux::is_nothrow_move_constructible<T>::value) {
+    new (memory) type_traits::placement::direct<T>(static_cast<T&&>(*static_cast<T*>(object)));
+  }
+
+  template <class T>
+  static void destroy(void* object) noexcept {
+    static_cast<T*>(object)->~T();
+  }
+
+  template <class T, class TVisitor>
+  static decltype(auto) apply(void* object, TVisitor& visitor) {
+    return visitor(*static_cast<T*>(object));
+  }
+
+  template <class T, class TVisitor>
+  static decltype(auto) apply(const void* object, TVisitor& visitor) {
+    return visitor(*static_cast<const T*>(object));
+  }
+
+  template <class T, class... Tx>
+  struct index_of;
+
+  template <class T, class... Tx>
+  struct index_of<T, T, Tx...> : aux::integral_constant<decltype(sizeof(0)), 0> {};
+
+  template <class T, class TOther, class... Tx>
+  struct index_of<T, TOther, Tx...> : aux::integral_constant<decltype(sizeof(0)), 1 + index_of<T, Tx...>::value> {};
+
+ public:
+  using size_type = decltype(sizeof(0));
+
+  template <class TSelector>
+  struct selector {
+    template <class TInjector>
+    one_of operator()(const TInjector& injector) const {
+      return one_of{static_cast<size_type>(selector_()), injector};
+    }
+
+    TSelector selector_;
+  };
+
+  template <class TInjector>
+  one_of(size_type index, const TInjector& injector) : index_(index) {
+    BOOST_DI_ASSERT(index < sizeof...(Ts));  // index of the selected implementation is out of range
+    using create_t = void (*)(void*, const TInjector&);
+    static constexpr create_t create_[] = {&create<Ts, TInjector>...};
+    create_[index_](&storage_, injector);
+  }
+
+  one_of(one_of&& other) noexcept(aux::is_same<aux::bool_list<aux::always<Ts>::value...>,
+                                               aux::bool_list<aux::is_nothrow_move_constructible<Ts>::value...>>::value)
+      : index_(other.index_) {
+    using move_t = void (*)(void*, void*);
+    static constexpr move_t move_[] = {&move<Ts>...};
+    move_[index_](&other.storage_, &storage_);
+  }
+
+  one_of(const one_of&) = delete;
+  one_of& operator=(const one_of&) = delete;
+  one_of& operator=(one_of&&) = delete;
+
+  ~one_of() noexcept {
+    using destroy_t = void (*)(void*);
+    static constexpr destroy_t destroy_[] = {&destroy<Ts>...};
+    destroy_[index_](&storage_);
+  }
+
+  size_type index() const noexcept { return index_; }
+
+  template <class T>
+  T* get_if() noexcept {
+    return index_ == index_of<T, Ts...>::value ? static_cast<T*>(static_cast<void*>(&storage_)) : nullptr;
+  }
+
+  template <class T>
+  const T* get_if() const noexcept {
+    return index_ == index_of<T, Ts...>::value ? static_cast<const T*>(static_cast<const void*>(&storage_)) : nullptr;
+  }
+
+  template <class TVisitor>
+  decltype(auto) visit(TVisitor visitor) {
+    using apply_t = decltype(apply<typename first<Ts...>::type, TVisitor>((void*)0, visitor)) (*)(void*, TVisitor&);
+    static constexpr apply_t apply_[] = {&apply<Ts, TVisitor>...};
+    return apply_[index_](&storage_, visitor);
+  }
+
+  template <class TVisitor>
+  decltype(auto) visit(TVisitor visitor) const {
+    using apply_t = decltype(apply<typename first<Ts...>::type, TVisitor>((const void*)0, visitor)) (*)(const void*, TVisitor&);
+    static constexpr apply_t apply_[] = {&apply<Ts, TVisitor>...};
+    return apply_[index_](&storage_, visitor);
+  }
+
+ private:
+  storage storage_;
+  size_type index_ = 0;
+};
+
+#endif
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_POLY_HPP
+#define BOOST_DI_POLY_HPP
+
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/aux_/utility.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/wrappers/unique.hpp"
+#include "boost/di/fwd.hpp"
+
+template <class T, decltype(sizeof(0)) N>
+class poly {
+  struct storage {
+    alignas(alignof(long double)) unsigned char data[N];
+  };
+
+  template <class TImpl>
+  struct local {
+    static T* relocate(T* object, void* memory) noexcept {
+      auto impl = static_cast<TImpl*>(object);
+      auto result = &(new (memory) type_traits::placement::direct<TImpl>(static_cast<TImpl&&>(*impl)))->object;
+      impl->~TImpl();
+      return result;
+    }
+    static void destroy(T* object) noexcept { static_cast<TImpl*>(object)->~TImpl(); }
+  };
+
+  template <class TImpl>
+  struct allocated {
+    static void destroy(T* object) noexcept { delete static_cast<TImpl*>(object); }
+  };
+
+ public:
+  template <class TImpl>
+  using fits = aux::integral_constant<bool, sizeof(TImpl) <= N && alignof(TImpl) <= alignof(storage) &&
+                                                aux::is_nothrow_move_constructible<TImpl>::value>;
+
+  poly() noexcept = default;
+
+  template <class TImpl, class TCreate>
+  poly(const aux::type<TImpl>&, const TCreate& create)
+      : object_(create(static_cast<void*>(&storage_))),
+        relocate_(&local<TImpl>::relocate),
+        destroy_(&local<TImpl>::destroy) {}
+
+  template <class TImpl>
+  explicit poly(aux::owner<TImpl*> object) noexcept : object_(object), destroy_(&allocated<TImpl>::destroy) {}
+
+  template <class TScope, class TImpl, BOOST_DI_REQUIRES(aux::is_convertible<TImpl*, T*>::value) = 0>
+  poly(const wrappers::unique<TScope, TImpl*>& wrapper) noexcept : poly(static_cast<aux::owner<TImpl*>>(wrapper.object)) {}
+
+  poly(poly&& other) noexcept { move(other); }
+
+  poly& operator=(poly&& other) noexcept {
+    if (this != &other) {
+      reset();
+      move(other);
+    }
+    return *this;
+  }
+
+  poly(const poly&) = delete;
+  poly& operator=(const poly&) = delete;
+
+  ~poly() noexcept { reset(); }
+
+  T* get() const noexcept { return object_; }
+  T& operator*() const noexcept { return *object_; }
+  T* operator->() const noexcept { return object_; }
+  explicit operator bool() const noexcept { return object_; }
+  bool inlined() const noexcept { return relocate_; }
+
+ private:
+  void move(poly& other) noexcept {
+    object_ = other.relocate_ ? other.relocate_(other.object_, &storage_) : other.object_;
+    relocate_ = other.relocate_;
+    destroy_ = other.destroy_;
+    other.object_ = nullptr;
+    other.relocate_ = nullptr;
+    other.destroy_ = nullptr;
+  }
+
+  void reset() noexcept {
+    if (object_) {
+      destroy_(object_);
+      object_ = nullptr;
+    }
+  }
+
+  storage storage_;
+  T* object_ = nullptr;
+  T* (*relocate_)(T*, void*) = nullptr;
+  void (*destroy_)(T*) = nullptr;
+};
+
+#endif
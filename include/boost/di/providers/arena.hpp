@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_PROVIDERS_ARENA_HPP
+#define BOOST_DI_PROVIDERS_ARENA_HPP
+
+#include "boost/di/type_traits/ctor_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/concepts/creatable.hpp"
+#include "boost/di/poly.hpp"
+#include "boost/di/providers/heap.hpp"
+#include "boost/di/fwd.hpp"
+
+namespace providers {
+
+class monotonic_buffer {
+  using size_t = decltype(sizeof(0));
+
+ public:
+  monotonic_buffer(void* data, size_t size) noexcept : data_(static_cast<char*>(data)), size_(size) {}
+
+  template <size_t N>
+  explicit monotonic_buffer(unsigned char (&data)[N]) noexcept : monotonic_buffer(data, N) {}
+
+  monotonic_buffer(const monotonic_buffer&) = delete;
+  monotonic_buffer& operator=(const monotonic_buffer&) = delete;
+
+  void* allocate(size_t size, size_t alignment) noexcept {
+    const auto address = reinterpret_cast<size_t>(data_ + used_);
+    const auto padding = (alignment - address % alignment) % alignment;
+    if (padding + size > size_ - used_) {
+      return nullptr;
+    }
+    auto ptr = data_ + used_ + padding;
+    used_ += padding + size;
+    return ptr;
+  }
+
+  bool owns(const void* ptr) const noexcept {
+    return static_cast<const char*>(ptr) >= data_ && static_cast<const char*>(ptr) < data_ + size_;
+  }
+
+  void release() noexcept { used_ = 0; }
+
+  size_t size() const noexcept { return size_; }
+  size_t used() const noexcept { return used_; }
+
+ private:
+  char* data_ = nullptr;
+  size_t size_ = 0;
+  size_t used_ = 0;
+};
+
+class arena {
+ public:
+  class deleter {
+   public:
+    deleter() noexcept = default;
+    explicit deleter(const monotonic_buffer* buffer) noexcept : buffer_(buffer) {}
+
+    template <class T>
+    void operator()(T* ptr) const noexcept {
+      if (buffer_ && buffer_->owns(ptr)) {
+        ptr->~T();
+      } else {
+        delete ptr;
+      }
+    }
+
+   private:
+    const monotonic_buffer* buffer_ = nullptr;
+  };
+
+  template <class TInitialization, class T, class... TArgs>
+  struct is_creatable {
+    static constexpr auto value = concepts::creatable<TInitialization, T, TArgs...>::value;
+  };
+
+  explicit arena(monotonic_buffer& buffer) noexcept : buffer_(&buffer) {}
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::heap&, TArgs&&... args) const {
+    using object_t = type_traits::placement::direct<T>;
+    if (auto memory = buffer_->allocate(sizeof(object_t), alignof(object_t))) {
+      return std::unique_ptr<T, deleter>{&(new (memory) object_t(static_cast<TArgs&&>(args)...))->object, deleter{buffer_}};
+    }
+    return std::unique_ptr<T, deleter>{new T(static_cast<TArgs&&>(args)...), deleter{buffer_}};
+  }
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::heap&, TArgs&&... args) const {
+    using object_t = type_traits::placement::uniform<T>;
+    if (auto memory = buffer_->allocate(sizeof(object_t), alignof(object_t))) {
+      return std::unique_ptr<T, deleter>{&(new (memory) object_t(static_cast<TArgs&&>(args)...))->object, deleter{buffer_}};
+    }
+    return std::unique_ptr<T, deleter>{new T{static_cast<TArgs&&>(args)...}, deleter{buffer_}};
+  }
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::direct<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::uniform<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) const {
+    return poly<I, N>{aux::type<T>{}, [&](void* memory) {
+                        return get<T>(init, type_traits::placement{memory}, static_cast<TArgs&&>(args)...);
+                      }};
+  }
+
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(!poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) const {
+    return poly<I, N>{heap{}.get<T>(init, type_traits::heap{}, static_cast<TArgs&&>(args)...)};
+  }
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::stack&, TArgs&&... args) const noexcept {
+    return T(static_cast<TArgs&&>(args)...);
+  }
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::stack&, TArgs&&... args) const noexcept {
+    return T{static_cast<TArgs&&>(args)...};
+  }
+
+ private:
+  monotonic_buffer* buffer_ = nullptr;
+};
+
+}  // providers
+
+#endif
@@ -8,6 +8,7 @@
 #define BOOST_DI_PROVIDERS_HEAP_HPP
 
 #include "boost/di/type_traits/ctor_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
 #include "boost/di/concepts/creatable.hpp"
 
 namespace providers {
@@ -10,9 +10,13 @@
 #include "boost/di/type_traits/ctor_traits.hpp"
 #include "boost/di/type_traits/memory_traits.hpp"
 #include "boost/di/concepts/creatable.hpp"
+#include "boost/di/poly.hpp"
 
 namespace providers {
 
+template <class>
+void allocate_shared() noexcept;
+
 class stack_over_heap {
  public:
   template <class TInitialization, class T, class... TArgs>
@@ -30,6 +34,48 @@ class stack_over_heap {
     return new T{static_cast<TArgs&&>(args)...};
   }
 
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::shared&, TArgs&&... args) {
+    return allocate_shared<T>(std::allocator<T>{}, static_cast<TArgs&&>(args)...);
+  }
+
+  template <class T>
+  auto get(const type_traits::uniform&, const type_traits::shared&) {
+    return allocate_shared<T>(std::allocator<T>{});
+  }
+
+  template <class T, class TArg, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::shared&, TArg&& arg, TArgs&&... args) {
+    using object_t = type_traits::placement::uniform<T>;
+    const auto object =
+        allocate_shared<object_t>(std::allocator<object_t>{}, static_cast<TArg&&>(arg), static_cast<TArgs&&>(args)...);
+    return std::shared_ptr<T>{object, &object->object};
+  }
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::direct&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::direct<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+
+  template <class T, class... TArgs>
+  auto get(const type_traits::uniform&, const type_traits::placement& memory, TArgs&&... args) const {
+    return &(new (memory.memory) type_traits::placement::uniform<T>(static_cast<TArgs&&>(args)...))->object;
+  }
+
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) const {
+    return poly<I, N>{aux::type<T>{}, [&](void* memory) {
+                        return get<T>(init, type_traits::placement{memory}, static_cast<TArgs&&>(args)...);
+                      }};
+  }
+
+  template <class T, class TInitialization, class I, decltype(sizeof(0)) N, class... TArgs,
+            BOOST_DI_REQUIRES(!poly<I, N>::template fits<T>::value) = 0>
+  auto get(const TInitialization& init, const type_traits::small_buffer<I, N>&, TArgs&&... args) {
+    return poly<I, N>{get<T>(init, type_traits::heap{}, static_cast<TArgs&&>(args)...)};
+  }
+
   template <class T, class... TArgs>
   auto get(const type_traits::direct&, const type_traits::stack&, TArgs&&... args) const noexcept {
     return T(static_cast<TArgs&&>(args)...);
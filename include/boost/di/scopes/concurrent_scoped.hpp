@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_CONCURRENT_SCOPED_HPP
+#define BOOST_DI_SCOPES_CONCURRENT_SCOPED_HPP
+
+#include "boost/di/aux_/atomic.hpp"
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"  // type_traits::stack
+#include "boost/di/scopes/singleton.hpp"           // has_shared_ptr__
+#include "boost/di/wrappers/shared.hpp"
+
+namespace scopes {
+
+class concurrent_scoped {
+  template <class TObject>
+  class storage {
+    static constexpr auto max_spins = 64;
+
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      TObject object;
+    };
+
+    struct rollback {
+      ~rollback() noexcept {
+        if (object) {
+          aux::atomic_store(object, static_cast<holder*>(nullptr));
+        }
+      }
+      holder** object;
+    };
+
+   public:
+    storage() noexcept {}
+    storage(storage&&) noexcept {}  // instances are bound to the injector which created them
+    storage(const storage&) = delete;
+    ~storage() noexcept {
+      if (object_ && object_ != busy()) {
+        object_->~holder();
+      }
+    }
+
+    template <class TProvider, class... TArgs>
+    TObject& get(const TProvider& provider, const TArgs&... args) {
+      auto object = aux::atomic_load(&object_);
+      return (object && object != busy() ? object : get_slow(provider, args...))->object;
+    }
+
+   private:
+    holder* busy() noexcept { return reinterpret_cast<holder*>(&object_); }
+
+    template <class TProvider, class... TArgs>
+    holder* get_slow(const TProvider& provider, const TArgs&... args) {
+      auto spins = 0;
+      for (;;) {
+        auto object = aux::atomic_load(&object_);
+        if (object && object != busy()) {
+          return object;
+        }
+        if (!object && aux::atomic_compare_exchange(&object_, object, busy())) {
+          rollback guard{&object_};
+          object = new (&storage_) holder{TObject(provider.get(args...))};
+          guard.object = nullptr;
+          aux::atomic_store(&object_, object);
+          return object;
+        }
+        if (spins < max_spins) {
+          ++spins;
+          aux::atomic_pause();
+        } else {
+          aux::atomic_yield();
+        }
+      }
+    }
+
+    alignas(holder) unsigned char storage_[sizeof(holder)];
+    holder* object_ = nullptr;
+  };
+
+ public:
+  template <class, class T, class = decltype(has_shared_ptr__(aux::declval<T>()))>
+  class scope {
+    using object_t =
+        aux::conditional_t<aux::conditional_t<aux::is_complete<T>::value, aux::is_abstract<T>, aux::true_type>::value,
+                           aux::none_type, T>;
+
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<concurrent_scoped, T&>::template is_referable<T_>;
+
+    template <class, class, class TProvider>
+    static decltype(wrappers::shared<concurrent_scoped, T&>{aux::declval<TProvider>().get(type_traits::stack{})}) try_create(
+        const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<concurrent_scoped, T&>(object_.get(provider, type_traits::stack{}));
+    }
+
+   private:
+    storage<object_t> object_;
+  };
+
+  template <class _, class T>
+  class scope<_, T, aux::true_type> {
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<concurrent_scoped, T>::template is_referable<T_>;
+
+    template <class, class, class TProvider, class T_ = aux::decay_t<decltype(aux::declval<TProvider>().get())>>
+    static decltype(wrappers::shared<concurrent_scoped, T_>{std::shared_ptr<T_>{aux::declval<TProvider>().get()}})
+    try_create(const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<concurrent_scoped, T, std::shared_ptr<T>&>{object_.get(provider)};
+    }
+
+   private:
+    storage<std::shared_ptr<T>> object_;
+  };
+};
+
+}  // scopes
+
+#endif
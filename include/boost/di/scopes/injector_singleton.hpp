@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_INJECTOR_SINGLETON_HPP
+#define BOOST_DI_SCOPES_INJECTOR_SINGLETON_HPP
+
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"  // type_traits::stack
+#include "boost/di/scopes/singleton.hpp"           // has_shared_ptr__
+#include "boost/di/wrappers/shared.hpp"
+
+namespace scopes {
+
+class injector_singleton {
+ public:
+  template <class, class T, class = decltype(has_shared_ptr__(aux::declval<T>()))>
+  class scope {
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      T object;
+    };
+
+    using holder_t =
+        aux::conditional_t<aux::conditional_t<aux::is_complete<T>::value, aux::is_abstract<T>, aux::true_type>::value,
+                           aux::none_type, holder>;
+
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<injector_singleton, T&>::template is_referable<T_>;
+
+    scope() noexcept {}
+    scope(scope&&) noexcept {}  // instances are bound to the injector which created them
+    scope(const scope&) = delete;
+    ~scope() noexcept {
+      if (object_) {
+        object_->~holder_t();
+      }
+    }
+
+    template <class, class, class TProvider>
+    static decltype(wrappers::shared<injector_singleton, T&>{aux::declval<TProvider>().get(type_traits::stack{})}) try_create(
+        const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return create_impl(provider);
+    }
+
+   private:
+    template <class TProvider>
+    wrappers::shared<injector_singleton, T&> create_impl(const TProvider& provider) {
+      if (!object_) {
+        object_ = new (&storage_) holder_t{provider.get(type_traits::stack{})};
+      }
+      return wrappers::shared<injector_singleton, T&>(object_->object);
+    }
+
+    alignas(holder_t) unsigned char storage_[sizeof(holder_t)];
+    holder_t* object_ = nullptr;
+  };
+
+  template <class _, class T>
+  class scope<_, T, aux::true_type> {
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<injector_singleton, T>::template is_referable<T_>;
+
+    scope() noexcept {}
+    scope(scope&&) noexcept {}  // instances are bound to the injector which created them
+    scope(const scope&) = delete;
+
+    template <class, class, class TProvider, class T_ = aux::decay_t<decltype(aux::declval<TProvider>().get())>>
+    static decltype(wrappers::shared<injector_singleton, T_>{std::shared_ptr<T_>{aux::declval<TProvider>().get()}})
+    try_create(const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return create_impl(provider);
+    }
+
+   private:
+    template <class TProvider>
+    auto create_impl(const TProvider& provider) {
+      if (!object_) {
+        object_ = std::shared_ptr<T>{provider.get()};
+      }
+      return wrappers::shared<injector_singleton, T, std::shared_ptr<T>&>{object_};
+    }
+
+    std::shared_ptr<T> object_;
+  };
+};
+
+}  // scopes
+
+#endif
@@ -12,6 +12,10 @@
 #include "boost/di/concepts/creatable.hpp"
 #include "boost/di/fwd.hpp"
 
+#if !defined(BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE)  // __pph__
+#define BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE 64     // __pph__
+#endif                                            // __pph__
+
 namespace scopes {
 
 class instance;
@@ -84,10 +88,11 @@ class instance {
 
     template <class, class, class TProvider>
     auto create(const TProvider&) const noexcept {
-      return wrappers::shared<instance, TGiven>{object_};
+      return wrappers::shared<instance, TGiven>{object_, &cache_};
     }
 
     std::shared_ptr<TGiven> object_;
+    wrappers::bridge_cache cache_;
   };
 
   template <class TExpected, class TGiven>
@@ -194,98 +199,155 @@ class instance {
   template <class _, class... Ts>
   class scope<_, aux::type_list<Ts...>> {
     template <class>
-    struct injector__;
+    struct vtable__;
 
     template <class TName, class T>
-    struct injector__<named<TName, T>> {
-      T (*f)(const injector__*) = nullptr;
-      explicit injector__(const decltype(f)& ptr) : f(ptr) {}
+    struct vtable__<named<TName, T>> {
+      using create_t = T (*)(const scope&);
+      constexpr explicit vtable__(create_t create) noexcept : create(create) {}
+      create_t create;
     };
 
-    struct injector : injector__<Ts>... {
-      void (*dtor)(injector*) = nullptr;
-      ~injector() noexcept { static_cast<injector*>(this)->dtor(this); }
+    struct vtable : vtable__<Ts>... {
+      constexpr vtable(void (*move)(void*, void*), void (*dtor)(void*), typename vtable__<Ts>::create_t... create) noexcept
+          : vtable__<Ts>(create)..., move(move), dtor(dtor) {}
+      void (*move)(void*, void*);
+      void (*dtor)(void*);
+    };
 
-      template <class TName, class T>
-      T create(const named<TName, T>&, const aux::true_type&) const noexcept {
-        return static_cast<const injector__<named<TName, T>>*>(this)->f(static_cast<const injector__<named<TName, T>>*>(this));
-      }
+    template <class TInjector>
+    struct inline_storage {
+      struct holder {
+        static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+        static void operator delete(void*, void*) noexcept {}
+        TInjector injector;
+      };
 
-      template <class T>
-      T create(const named<no_name, T>&, const aux::false_type&) const noexcept {
-        return typename concepts::type<T>::is_not_exposed{};
+      static const TInjector& get(const void* data) noexcept { return static_cast<const holder*>(data)->injector; }
+      static void construct(void* data, TInjector&& injector) noexcept {
+        new (data) holder{static_cast<TInjector&&>(injector)};
       }
+      static void move(void* to, void* from) noexcept {
+        construct(to, static_cast<TInjector&&>(static_cast<holder*>(from)->injector));
+        dtor(from);
+      }
+      static void dtor(void* data) noexcept { static_cast<holder*>(data)->~holder(); }
+    };
 
-      template <class TName, class T>
-      T create(const named<TName, T>&, const aux::false_type&) const noexcept {
-        return typename concepts::type<T>::template named<TName>::is_not_exposed{};
+    template <class TInjector>
+    struct heap_storage {
+      static const TInjector& get(const void* data) noexcept { return **static_cast<TInjector* const*>(data); }
+      static void construct(void* data, TInjector&& injector) noexcept {
+        *static_cast<TInjector**>(data) = new TInjector{static_cast<TInjector&&>(injector)};
       }
+      static void move(void* to, void* from) noexcept { *static_cast<TInjector**>(to) = *static_cast<TInjector**>(from); }
+      static void dtor(void* data) noexcept { delete *static_cast<TInjector**>(data); }
     };
 
+    /**
+     * Scopes with state (injector_singleton, thread_local_, pooled, instance, ...) own objects handed out by reference,
+     * which have to keep their address when the exposed injector is moved
+     */
+    template <class>
+    struct is_stateless;
+
+    template <template <class...> class TList, class... TDeps>
+    struct is_stateless<TList<TDeps...>>
+        : aux::is_same<aux::bool_list<aux::always<TDeps>::value...>,
+                       aux::bool_list<aux::is_empty<typename TDeps::scope::template scope<typename TDeps::expected,
+                                                                                           typename TDeps::given>>::value...>> {};
+
     template <class TInjector>
-    class injector_impl : injector__<Ts>... {
-      void (*dtor)(injector_impl*) = nullptr;
-      static void dtor_impl(injector_impl* object) { object->~injector_impl(); }
-
-      template <class, class>
-      struct create;
-
-      template <class TName, class T>
-      struct create<named<TName, T>, aux::true_type> {
-        static T impl(const injector__<named<TName, T>>* object) noexcept {
-          using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
-          return static_cast<const core::injector__<TInjector>&>(static_cast<const injector_impl*>(object)->injector_)
-              .create_successful_impl(type{});
-        }
-      };
+    using storage_t =
+        aux::conditional_t<(sizeof(TInjector) <= BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE && alignof(TInjector) <= alignof(double) &&
+                            noexcept(TInjector{aux::declval<TInjector&&>()}) &&
+                            is_stateless<typename TInjector::deps>::value),
+                           inline_storage<TInjector>, heap_storage<TInjector>>;
+
+    static_assert(BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE >= sizeof(void*),
+                  "BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE has to fit a pointer to the heap allocated injector");
+
+    template <class, class, class, class>
+    struct dispatch;
+
+    template <class TInjector, class TStorage, class TName, class T>
+    struct dispatch<TInjector, TStorage, named<TName, T>, aux::true_type> {
+      static T impl(const scope& self) noexcept {
+        using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
+        return static_cast<const core::injector__<TInjector>&>(TStorage::get(&self.storage_)).create_successful_impl(type{});
+      }
+    };
 
-      template <class TName, class T>
-      struct create<named<TName, T>, aux::false_type> {
-        static T impl(const injector__<named<TName, T>>* object) noexcept {
-          using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
-          return static_cast<const core::injector__<TInjector>&>(static_cast<const injector_impl*>(object)->injector_)
-              .create_impl(type{});
-        }
-      };
+    template <class TInjector, class TStorage, class TName, class T>
+    struct dispatch<TInjector, TStorage, named<TName, T>, aux::false_type> {
+      static T impl(const scope& self) noexcept {
+        using type = aux::type<aux::conditional_t<aux::is_same<TName, no_name>::value, T, named<TName, T>>>;
+        return static_cast<const core::injector__<TInjector>&>(TStorage::get(&self.storage_)).create_impl(type{});
+      }
+    };
 
-      template <class T>
-      struct is_creatable : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T>::value> {};
+    template <class TInjector, class T>
+    struct is_creatable : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T>::value> {};
 
-      template <class TName, class T>
-      struct is_creatable<named<TName, T>>
-          : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T, TName>::value> {};
+    template <class TInjector, class TName, class T>
+    struct is_creatable<TInjector, named<TName, T>>
+        : aux::integral_constant<bool, core::injector__<TInjector>::template is_creatable<T, TName>::value> {};
 
-     public:
-      explicit injector_impl(TInjector&& injector) noexcept
-          : injector__<Ts>(&injector_impl::template create<Ts, typename is_creatable<Ts>::type>::impl)...,
-            dtor(&injector_impl::dtor_impl),
-            injector_(static_cast<TInjector&&>(injector)) {}
+    template <class TInjector, class TStorage = storage_t<TInjector>>
+    static const vtable* vtable_impl() noexcept {
+      static constexpr vtable object{&TStorage::move, &TStorage::dtor,
+                                     &dispatch<TInjector, TStorage, Ts, typename is_creatable<TInjector, Ts>::type>::impl...};
+      return &object;
+    }
 
-     private:
-      TInjector injector_;
-    };
+    template <class TName, class T>
+    T create_impl(const named<TName, T>&, const aux::true_type&) const noexcept {
+      return static_cast<const vtable__<named<TName, T>>*>(vtable_)->create(*this);
+    }
+
+    template <class T>
+    T create_impl(const named<no_name, T>&, const aux::false_type&) const noexcept {
+      return typename concepts::type<T>::is_not_exposed{};
+    }
+
+    template <class TName, class T>
+    T create_impl(const named<TName, T>&, const aux::false_type&) const noexcept {
+      return typename concepts::type<T>::template named<TName>::is_not_exposed{};
+    }
 
    public:
     template <class>
     using is_referable = aux::true_type;
 
     template <class TInjector, BOOST_DI_REQUIRES(aux::is_a<core::injector_base, TInjector>::value) = 0>
-    explicit scope(TInjector&& i) noexcept : injector_((injector*) new injector_impl<TInjector>{static_cast<TInjector&&>(i)}) {}
+    explicit scope(TInjector&& i) noexcept : vtable_(vtable_impl<TInjector>()) {
+      storage_t<TInjector>::construct(&storage_, static_cast<TInjector&&>(i));
+    }
+
+    scope(scope&& other) noexcept : vtable_(other.vtable_) {
+      if (vtable_) {
+        vtable_->move(&storage_, &other.storage_);
+        other.vtable_ = nullptr;
+      }
+    }
 
-    scope(scope&& other) noexcept : injector_(other.injector_) { other.injector_ = nullptr; }
-    ~scope() noexcept { delete injector_; }
+    ~scope() noexcept {
+      if (vtable_) {
+        vtable_->dtor(&storage_);
+      }
+    }
 
     template <class T, class TName, class TProvider>
-    static aux::conditional_t<aux::is_base_of<injector__<named<TName, T>>, injector>::value, T, void> try_create(
-        const TProvider&);
+    static aux::conditional_t<aux::is_base_of<vtable__<named<TName, T>>, vtable>::value, T, void> try_create(const TProvider&);
 
     template <class T, class TName, class TProvider>
     auto create(const TProvider&) {
-      return wrapper<T>{injector_->create(named<TName, T>{}, aux::is_base_of<injector__<named<TName, T>>, injector>{})};
+      return wrapper<T>{create_impl(named<TName, T>{}, aux::is_base_of<vtable__<named<TName, T>>, vtable>{})};
     }
 
    private:
-    injector* injector_;
+    const vtable* vtable_ = nullptr;
+    alignas(double) unsigned char storage_[BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE];
   };
 };
 
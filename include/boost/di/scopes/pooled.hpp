@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_POOLED_HPP
+#define BOOST_DI_SCOPES_POOLED_HPP
+
+#include "boost/di/aux_/atomic.hpp"
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/wrappers/unique.hpp"
+#include "boost/di/fwd.hpp"
+
+#if !defined(BOOST_DI_CFG_POOL_SIZE)  // __pph__
+#define BOOST_DI_CFG_POOL_SIZE 32     // __pph__
+#endif                                // __pph__
+
+class pool_return_deleter {
+ public:
+  pool_return_deleter() noexcept = default;
+  pool_return_deleter(void (*release)(void*), void* block) noexcept : release_(release), block_(block) {}
+
+  template <class T>
+  void operator()(T*) const noexcept {
+    release_(block_);
+  }
+
+ private:
+  void (*release_)(void*) = nullptr;
+  void* block_ = nullptr;
+};
+
+struct pool_statistics {
+  unsigned long hits;
+  unsigned long misses;
+};
+
+namespace scopes {
+
+BOOST_DI_HAS_METHOD(has_reset, reset);
+
+class pooled {
+  template <class T>
+  class pool {
+    struct cache;
+
+    struct block {
+      alignas(T) unsigned char object[sizeof(T)];
+      block* next;
+      cache* owner;
+    };
+
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      T object;
+    };
+
+    // objects of one pool cached by one thread, referenced by the thread, the pool and objects in use,
+    // dead when either the thread or the pool is gone
+    struct cache {
+      long id;
+      cache* next;     // used by the same thread
+      cache* sibling;  // used by the same pool
+      const void* thread;
+      block* objects;
+      int size;
+      long dead;
+      long references;
+    };
+
+    struct caches {
+      ~caches() noexcept {
+        while (auto cache = head) {
+          head = cache->next;
+          detach(cache);
+        }
+      }
+
+      cache* head = nullptr;
+    };
+
+    static holder* object(block* object) noexcept { return reinterpret_cast<holder*>(object->object); }
+
+    static void recycle(block* object, const aux::true_type&) noexcept { pool::object(object)->object.reset(); }
+    static void recycle(block* object, const aux::false_type&) noexcept { pool::object(object)->~holder(); }
+    static void destroy(block* object, const aux::true_type&) noexcept { pool::object(object)->~holder(); }
+    static void destroy(block*, const aux::false_type&) noexcept {}
+
+    static caches& local() noexcept {
+      static thread_local caches caches_;
+      return caches_;
+    }
+
+    static long next_id() noexcept {
+      static long ids = 0;
+      return aux::atomic_increment(&ids);
+    }
+
+    static void release(cache* cache) noexcept {
+      if (!aux::atomic_decrement(&cache->references)) {
+        delete cache;
+      }
+    }
+
+    static void detach(cache* cache) noexcept {
+      while (auto object = cache->objects) {
+        cache->objects = object->next;
+        destroy(object, has_reset<T&>{});
+        delete object;
+      }
+      aux::atomic_increment(&cache->dead);
+      release(cache);
+    }
+
+    static void release(void* ptr) noexcept {
+      auto object = static_cast<block*>(ptr);
+      auto cache = object->owner;
+      if (cache->thread == &local() && !aux::atomic_load(&cache->dead) && cache->size < BOOST_DI_CFG_POOL_SIZE) {
+        recycle(object, has_reset<T&>{});
+        object->next = cache->objects;
+        cache->objects = object;
+        ++cache->size;
+      } else {
+        pool::object(object)->~holder();
+        delete object;
+      }
+      release(cache);
+    }
+
+    cache& local_cache() {
+      auto& caches = local();
+      for (auto cache = &caches.head; *cache;) {
+        if ((*cache)->id == id_) {
+          return **cache;
+        }
+        if (aux::atomic_load(&(*cache)->dead)) {  // used by an already destroyed pool
+          auto next = (*cache)->next;
+          detach(*cache);
+          *cache = next;
+        } else {
+          cache = &(*cache)->next;
+        }
+      }
+      caches.head = new cache{id_, caches.head, nullptr, &caches, nullptr, 0, 0, 2};
+      do {
+        caches.head->sibling = aux::atomic_load(&caches_);
+      } while (!aux::atomic_compare_exchange(&caches_, caches.head->sibling, caches.head));
+      return *caches.head;
+    }
+
+    long id_ = 0;
+    cache* caches_ = nullptr;
+
+   public:
+    pool() noexcept : id_(next_id()) {}
+    pool(pool&&) noexcept : id_(next_id()) {}  // objects are cached per pool of the injector which created them
+    pool(const pool&) = delete;
+    ~pool() noexcept {
+      for (auto cache = aux::atomic_load(&caches_); cache;) {
+        auto sibling = cache->sibling;
+        aux::atomic_increment(&cache->dead);
+        release(cache);
+        cache = sibling;
+      }
+    }
+
+    static pool_statistics& statistics() noexcept {
+      static thread_local pool_statistics statistics_{};
+      return statistics_;
+    }
+
+    template <class TProvider>
+    std::unique_ptr<T, pool_return_deleter> get(const TProvider& provider) {
+      auto& cache = local_cache();
+      auto object = cache.objects;
+      if (object && has_reset<T&>::value) {
+        cache.objects = object->next;
+        --cache.size;
+        ++statistics().hits;
+      } else {
+        object = create(cache, provider);
+      }
+      aux::atomic_increment(&cache.references);
+      return {&pool::object(object)->object, pool_return_deleter{&release, object}};
+    }
+
+   private:
+    struct rollback {
+      ~rollback() noexcept { delete object; }
+      block* object;
+    };
+
+    // the block is taken only once the object has been constructed, so that a throwing constructor doesn't lose it
+    template <class TProvider>
+    static block* create(cache& cache, const TProvider& provider) {
+      if (auto object = cache.objects) {
+        new (object->object) holder{provider.get(type_traits::stack{})};
+        cache.objects = object->next;
+        --cache.size;
+        ++statistics().hits;
+        return object;
+      }
+      rollback guard{new block};
+      new (guard.object->object) holder{provider.get(type_traits::stack{})};
+      auto object = guard.object;
+      guard.object = nullptr;
+      object->owner = &cache;
+      ++statistics().misses;
+      return object;
+    }
+  };
+
+ public:
+  template <class T>
+  static pool_statistics statistics() noexcept {
+    return pool<T>::statistics();
+  }
+
+  template <class, class T>
+  class scope {
+   public:
+    template <class>
+    using is_referable = aux::false_type;
+
+    template <class, class, class TProvider, class T_ = decltype(aux::declval<TProvider>().get(type_traits::stack{}))>
+    static wrappers::unique<pooled, std::unique_ptr<T_, pool_return_deleter>> try_create(const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::unique<pooled, std::unique_ptr<T, pool_return_deleter>>{pool_.get(provider)};
+    }
+
+   private:
+    pool<T> pool_;
+  };
+};
+
+}  // scopes
+
+#endif
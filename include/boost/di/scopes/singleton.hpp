@@ -62,7 +62,8 @@ class singleton {
     template <class T_, class TProvider>
     auto create_impl(const TProvider& provider) {
       static std::shared_ptr<T_> object{provider.get()};
-      return wrappers::shared<singleton, T_, std::shared_ptr<T_>&>{object};
+      static wrappers::bridge_cache cache;
+      return wrappers::shared<singleton, T_, std::shared_ptr<T_>&>{object, &cache};
     }
   };
 };
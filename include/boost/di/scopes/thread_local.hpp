@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_THREAD_LOCAL_HPP
+#define BOOST_DI_SCOPES_THREAD_LOCAL_HPP
+
+#include "boost/di/aux_/atomic.hpp"
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"  // type_traits::stack
+#include "boost/di/scopes/singleton.hpp"           // has_shared_ptr__
+#include "boost/di/wrappers/shared.hpp"
+
+namespace scopes {
+
+class thread_local_ {
+  // owned by both, the creating thread and the storage, first one destroys the object, last one deallocates
+  struct node {
+    virtual ~node() noexcept = default;
+    virtual void destroy() noexcept = 0;
+
+    long id = 0;
+    node* next = nullptr;     // created by the same thread, newest first
+    node* sibling = nullptr;  // created by the same storage
+    long destroyed = 0;
+    long released = 0;
+  };
+
+  struct objects {
+    ~objects() noexcept {
+      while (auto object = head) {
+        head = object->next;
+        release(object);
+      }
+    }
+
+    node* head = nullptr;
+  };
+
+  static node*& head() noexcept {
+    static thread_local objects objects_;
+    return objects_.head;
+  }
+
+  static void release(node* object) noexcept {
+    if (aux::atomic_increment(&object->destroyed) == 1) {
+      object->destroy();
+    }
+    if (aux::atomic_increment(&object->released) == 2) {
+      delete object;
+    }
+  }
+
+  template <class TObject>
+  class storage {
+    struct holder {
+      static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+      static void operator delete(void*, void*) noexcept {}
+      TObject object;
+    };
+
+    struct holder_node : node {
+      void destroy() noexcept override { object->~holder(); }
+
+      holder* object = nullptr;
+      alignas(holder) unsigned char storage_[sizeof(holder)];
+    };
+
+    static long next_id() noexcept {
+      static long ids = 0;
+      return aux::atomic_increment(&ids);
+    }
+
+    struct cache {
+      long id;
+      holder_node* object;
+    };
+
+    // last object of this type found by the calling thread, ids are never reused, so a stale entry is never dereferenced
+    static cache& last() noexcept {
+      static thread_local cache last_{0, nullptr};
+      return last_;
+    }
+
+   public:
+    storage() noexcept : id_(next_id()) {}
+    storage(storage&&) noexcept : id_(next_id()) {}  // instances are bound to the injector which created them
+    storage(const storage&) = delete;
+    ~storage() noexcept {
+      for (auto object = aux::atomic_load(&objects_); object;) {
+        auto sibling = object->sibling;
+        release(object);
+        object = sibling;
+      }
+    }
+
+    template <class TProvider, class... TArgs>
+    TObject& get(const TProvider& provider, const TArgs&... args) {
+      if (last().id == id_) {
+        return last().object->object->object;
+      }
+      for (auto object = &head(); *object;) {
+        if ((*object)->id == id_) {
+          last() = cache{id_, static_cast<holder_node*>(*object)};
+          return last().object->object->object;
+        }
+        if (aux::atomic_load(&(*object)->destroyed)) {  // created for an already destroyed injector
+          auto next = (*object)->next;
+          release(*object);
+          *object = next;
+        } else {
+          object = &(*object)->next;
+        }
+      }
+      return create(provider, args...);
+    }
+
+   private:
+    template <class TProvider, class... TArgs>
+    TObject& create(const TProvider& provider, const TArgs&... args) {
+      auto object = new holder_node{};
+      object->id = id_;
+      object->object = new (&object->storage_) holder{TObject(provider.get(args...))};
+      object->next = head();  // after dependencies created by the provider, so that they are destroyed later
+      head() = object;
+      last() = cache{id_, object};
+      do {
+        object->sibling = aux::atomic_load(&objects_);
+      } while (!aux::atomic_compare_exchange(&objects_, object->sibling, static_cast<node*>(object)));
+      return object->object->object;
+    }
+
+    long id_ = 0;
+    node* objects_ = nullptr;
+  };
+
+ public:
+  template <class, class T, class = decltype(has_shared_ptr__(aux::declval<T>()))>
+  class scope {
+    using object_t =
+        aux::conditional_t<aux::conditional_t<aux::is_complete<T>::value, aux::is_abstract<T>, aux::true_type>::value,
+                           aux::none_type, T>;
+
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<thread_local_, T&>::template is_referable<T_>;
+
+    template <class, class, class TProvider>
+    static decltype(wrappers::shared<thread_local_, T&>{aux::declval<TProvider>().get(type_traits::stack{})}) try_create(
+        const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<thread_local_, T&>(object_.get(provider, type_traits::stack{}));
+    }
+
+   private:
+    storage<object_t> object_;
+  };
+
+  template <class _, class T>
+  class scope<_, T, aux::true_type> {
+   public:
+    template <class T_>
+    using is_referable = typename wrappers::shared<thread_local_, T>::template is_referable<T_>;
+
+    template <class, class, class TProvider, class T_ = aux::decay_t<decltype(aux::declval<TProvider>().get())>>
+    static decltype(wrappers::shared<thread_local_, T_>{std::shared_ptr<T_>{aux::declval<TProvider>().get()}})
+    try_create(const TProvider&);
+
+    template <class, class, class TProvider>
+    auto create(const TProvider& provider) {
+      return wrappers::shared<thread_local_, T, std::shared_ptr<T>&>{object_.get(provider)};
+    }
+
+   private:
+    storage<std::shared_ptr<T>> object_;
+  };
+};
+
+}  // scopes
+
+#endif
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SEALED_HPP
+#define BOOST_DI_SEALED_HPP
+
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/aux_/utility.hpp"
+#include "boost/di/core/binder.hpp"
+#include "boost/di/fwd.hpp"
+
+template <class I, class TImpl = I>
+class sealed {
+ public:
+  sealed() noexcept = default;
+
+  template <class T, BOOST_DI_REQUIRES(aux::is_convertible<T*, TImpl*>::value && aux::is_convertible<T*, I*>::value) = 0>
+  explicit sealed(aux::owner<T*> object) noexcept : object_(object) {}
+
+  sealed(sealed&& other) noexcept : object_(other.object_) { other.object_ = nullptr; }
+
+  sealed& operator=(sealed&& other) noexcept {
+    if (this != &other) {
+      delete object_;
+      object_ = other.object_;
+      other.object_ = nullptr;
+    }
+    return *this;
+  }
+
+  sealed(const sealed&) = delete;
+  sealed& operator=(const sealed&) = delete;
+
+  ~sealed() noexcept { delete object_; }
+
+  TImpl* get() const noexcept { return object_; }
+  TImpl& operator*() const noexcept { return *object_; }
+  TImpl* operator->() const noexcept { return object_; }
+  explicit operator bool() const noexcept { return object_; }
+
+ private:
+  TImpl* object_ = nullptr;
+};
+
+template <class I, class TImpl>
+struct smart_ptr_traits<sealed<I, TImpl>> {
+  using element_type = I;
+};
+
+template <class TInjector, class I, class TGiven = typename core::binder::resolve_t<TInjector, I>::given>
+using sealed_t = sealed<I, aux::conditional_t<aux::is_base_of<I, TGiven>::value, TGiven, I>>;
+
+#endif
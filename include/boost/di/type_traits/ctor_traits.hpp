@@ -15,6 +15,9 @@
 #define BOOST_DI_CFG_CTOR_LIMIT_SIZE 10     // __pph__
 #endif                                      // __pph__
 
+template <class, class = int>
+struct ctor_limit : aux::integral_constant<int, BOOST_DI_CFG_CTOR_LIMIT_SIZE> {};
+
 namespace type_traits {
 
 BOOST_DI_HAS_TYPE(is_injectable, boost_di_inject__);
@@ -54,14 +57,54 @@ struct ctor_impl<TIsConstructible, T, aux::index_sequence<Ns...>,
                        aux::type_list<get<core::any_type_ref_fwd<T>, Ns>...>,
                        typename ctor_impl<TIsConstructible, T, aux::make_index_sequence<sizeof...(Ns)-1>>::type> {};
 
-template <template <class...> class TIsConstructible, class T>
-using ctor_impl_t = typename ctor_impl<TIsConstructible, T, aux::make_index_sequence<BOOST_DI_CFG_CTOR_LIMIT_SIZE>>::type;
+template <class T, int N>
+using ctor_any_fwd = aux::conditional_t<N == 1, core::any_type_1st_fwd<T>, core::any_type_fwd<T>>;
+
+template <class T, int N>
+using ctor_any_ref_fwd = aux::conditional_t<N == 1, core::any_type_1st_ref_fwd<T>, core::any_type_ref_fwd<T>>;
+
+template <class, class, class = int>
+struct ctor_braces;
+
+template <class T, int... Ns>
+struct ctor_braces<T, aux::index_sequence<Ns...>,
+                   BOOST_DI_REQUIRES(aux::is_braces_constructible<T, get<ctor_any_fwd<T, sizeof...(Ns)>, Ns>...>::value)>
+    : aux::type_list<get<ctor_any_fwd<T, sizeof...(Ns)>, Ns>...> {
+  static constexpr auto value = true;
+};
+
+template <class T, int... Ns>
+struct ctor_braces<T, aux::index_sequence<Ns...>,
+                   BOOST_DI_REQUIRES(!aux::is_braces_constructible<T, get<ctor_any_fwd<T, sizeof...(Ns)>, Ns>...>::value)>
+    : aux::type_list<get<ctor_any_ref_fwd<T, sizeof...(Ns)>, Ns>...> {
+  static constexpr auto value = aux::is_braces_constructible<T, get<ctor_any_ref_fwd<T, sizeof...(Ns)>, Ns>...>::value;
+};
+
+template <class T, int N>
+using ctor_braces_t = ctor_braces<T, aux::make_index_sequence<N>>;
+
+template <class T, int N, int TMax = ctor_limit<T>::value>
+struct ctor_uniform : aux::conditional_t<ctor_braces_t<T, N>::value && !ctor_braces_t<T, N + 1>::value,
+                                           ctor_braces_t<T, N>, ctor_uniform<T, N + 1, TMax>> {};
+
+template <class T, int TMax>
+struct ctor_uniform<T, TMax, TMax>
+    : aux::conditional_t<ctor_braces_t<T, TMax>::value, ctor_braces_t<T, TMax>, aux::type_list<>> {};
+
+template <class T, class = typename aux::is_aggregate<T>::type>
+struct ctor_args : ctor_impl<aux::is_constructible, T, aux::make_index_sequence<ctor_limit<T>::value>> {};
+
+template <class T>
+struct ctor_args<T, aux::true_type> : aux::type_list<> {};
+
+template <class T>
+using ctor_args_t = typename ctor_args<T>::type;
 
 template <class...>
 struct ctor;
 
 template <class T>
-struct ctor<T, aux::type_list<>> : aux::pair<uniform, ctor_impl_t<aux::is_braces_constructible, T>> {};
+struct ctor<T, aux::type_list<>> : aux::pair<uniform, typename ctor_uniform<T, 0>::type> {};
 
 template <class T, class... TArgs>
 struct ctor<T, aux::type_list<TArgs...>> : aux::pair<direct, aux::type_list<TArgs...>> {};
@@ -88,7 +131,7 @@ struct ctor_traits_impl<T, _, aux::false_type> : aux::pair<T, typename ctor_trai
 }  // type_traits
 
 template <class T, class>
-struct ctor_traits : type_traits::ctor<T, type_traits::ctor_impl_t<aux::is_constructible, T>> {};
+struct ctor_traits : type_traits::ctor<T, type_traits::ctor_args_t<T>> {};
 
 template <class T>
 struct ctor_traits<std::initializer_list<T>> {
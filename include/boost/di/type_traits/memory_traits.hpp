@@ -14,6 +14,35 @@ namespace type_traits {
 
 struct stack {};
 struct heap {};
+struct shared : heap {};
+struct placement {
+  template <class T>
+  struct direct {
+    template <class... TArgs>
+    explicit direct(TArgs&&... args) : object(static_cast<TArgs&&>(args)...) {}
+    static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+    static void operator delete(void*, void*) noexcept {}
+    T object;
+  };
+
+  template <class T>
+  struct uniform {
+    template <class... TArgs>
+    explicit uniform(TArgs&&... args) : object{static_cast<TArgs&&>(args)...} {}
+    static void* operator new(decltype(sizeof(0)), void* ptr) noexcept { return ptr; }
+    static void operator delete(void*, void*) noexcept {}
+    T object;
+  };
+
+  template <class T>
+  struct storage {
+    alignas(T) unsigned char data[sizeof(T)];
+  };
+
+  void* memory;
+};
+template <class, decltype(sizeof(0))>
+struct small_buffer {};
 
 template <class T, class = int>
 struct memory_traits {
@@ -37,7 +66,7 @@ struct memory_traits<std::unique_ptr<T, TDeleter>> {
 
 template <class T>
 struct memory_traits<std::shared_ptr<T>> {
-  using type = heap;
+  using type = shared;
 };
 
 template <class T>
@@ -50,6 +79,16 @@ struct memory_traits<std::weak_ptr<T>> {
   using type = heap;
 };
 
+template <class T, decltype(sizeof(0)) N>
+struct memory_traits<poly<T, N>> {
+  using type = small_buffer<T, N>;
+};
+
+template <class T>
+struct memory_traits<T, aux::valid_t<typename smart_ptr_traits<T>::element_type>> {
+  using type = heap;
+};
+
 template <class T>
 struct memory_traits<T, BOOST_DI_REQUIRES(aux::is_polymorphic<T>::value)> {
   using type = heap;
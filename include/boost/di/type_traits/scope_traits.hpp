@@ -37,6 +37,11 @@ struct scope_traits<std::weak_ptr<T>> {
   using type = scopes::singleton;
 };
 
+template <class T>
+struct scope_traits<borrowed<T>> {
+  using type = scopes::singleton;
+};
+
 template <class T>
 using scope_traits_t = typename scope_traits<T>::type;
 
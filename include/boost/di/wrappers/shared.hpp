@@ -7,12 +7,62 @@
 #ifndef BOOST_DI_WRAPPERS_SHARED_HPP
 #define BOOST_DI_WRAPPERS_SHARED_HPP
 
+#include "boost/di/aux_/atomic.hpp"
 #include "boost/di/aux_/utility.hpp"
 #include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/borrowed.hpp"
 #include "boost/di/fwd.hpp"
 
 namespace wrappers {
 
+template <class TBridged, class T>
+inline TBridged bridge(const std::shared_ptr<T>& object) noexcept {
+  struct sp_holder {
+    std::shared_ptr<T> object;
+    void operator()(...) noexcept { object.reset(); }
+  };
+  return {object.get(), sp_holder{object}};
+}
+
+class bridge_cache {
+  struct holder {
+    void (*destroy)(holder*);
+  };
+
+  template <class TBridged>
+  struct bridged : holder {
+    explicit bridged(const TBridged& object) : holder{&destroy}, object(object) {}
+    static void destroy(holder* object) noexcept { delete static_cast<bridged*>(object); }
+    TBridged object;
+  };
+
+ public:
+  bridge_cache() noexcept {}
+  bridge_cache(const bridge_cache&) noexcept {}  // bridged objects are bound to the object they were created from
+  bridge_cache& operator=(const bridge_cache&) = delete;
+  ~bridge_cache() noexcept {
+    if (object_) {
+      object_->destroy(object_);
+    }
+  }
+
+  template <class TBridged, class T>
+  const TBridged& get(const std::shared_ptr<T>& object) const noexcept {
+    auto cached = static_cast<bridged<TBridged>*>(aux::atomic_load(&object_));
+    if (!cached) {
+      cached = new bridged<TBridged>{bridge<TBridged>(object)};
+      if (!aux::atomic_compare_exchange(&object_, static_cast<holder*>(nullptr), static_cast<holder*>(cached))) {
+        delete cached;
+        cached = static_cast<bridged<TBridged>*>(aux::atomic_load(&object_));
+      }
+    }
+    return cached->object;
+  }
+
+ private:
+  mutable holder* object_ = nullptr;
+};
+
 template <class TScope, class T, class TObject = std::shared_ptr<T>>
 struct shared {
   using scope = TScope;
@@ -38,11 +88,10 @@ struct shared {
 
   template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
   inline operator boost::shared_ptr<I>() const noexcept {
-    struct sp_holder {
-      std::shared_ptr<T> object;
-      void operator()(...) noexcept { object.reset(); }
-    };
-    return {object.get(), sp_holder{object}};
+    if (cache) {
+      return cache->template get<boost::shared_ptr<T>>(object);
+    }
+    return bridge<boost::shared_ptr<T>>(object);
   }
 
   template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
@@ -50,10 +99,23 @@ struct shared {
     return object;
   }
 
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator borrowed<I>() const noexcept {
+    return borrowed<I>{*object};
+  }
+
+  template <class TPtr, class I = typename smart_ptr_traits<TPtr>::element_type,
+            BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value &&
+                              aux::is_constructible<TPtr, const std::shared_ptr<T>&>::value) = 0>
+  inline operator TPtr() const noexcept {
+    return TPtr{object};
+  }
+
   inline operator T&() noexcept { return *object; }
   inline operator const T&() const noexcept { return *object; }
 
   TObject object;
+  const bridge_cache* cache = nullptr;
 };
 
 template <class TScope, class T>
@@ -75,6 +137,11 @@ struct shared<TScope, T&> {
 
   inline operator T&() const noexcept { return *object; }
 
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator borrowed<I>() const noexcept {
+    return borrowed<I>{*object};
+  }
+
   T* object = nullptr;
 };
 
@@ -22,6 +22,11 @@ struct unique {
     return object;
   }
 
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T, I>::value) = 0>
+  inline operator I() noexcept {
+    return static_cast<T&&>(object);
+  }
+
   inline operator T &&() noexcept { return static_cast<T&&>(object); }
 
   // private:
@@ -73,9 +78,57 @@ struct unique<TScope, T*> {
     return std::unique_ptr<I, D>{object};
   }
 
+  template <class TPtr, class I = typename smart_ptr_traits<TPtr>::element_type,
+            BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator TPtr() const noexcept {
+    return TPtr{object};
+  }
+
   T* object = nullptr;
 };
 
+template <class TScope, class T, class TDeleter>
+struct unique<TScope, std::unique_ptr<T, TDeleter>> {
+  using scope = TScope;
+
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T, I>::value) = 0>
+  inline operator I() const noexcept {
+    return *object;
+  }
+
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value &&
+                                       aux::is_same<TDeleter, std::default_delete<T>>::value) = 0>
+  inline operator aux::owner<I*>() noexcept {
+    return object.release();
+  }
+
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, const I*>::value &&
+                                       aux::is_same<TDeleter, std::default_delete<T>>::value) = 0>
+  inline operator aux::owner<const I*>() noexcept {
+    return object.release();
+  }
+
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value) = 0>
+  inline operator std::shared_ptr<I>() noexcept {
+    return {object.release(), object.get_deleter()};
+  }
+
+  template <class I, class D,
+            BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value && aux::is_convertible<TDeleter, D>::value) = 0>
+  inline operator std::unique_ptr<I, D>() noexcept {
+    return static_cast<std::unique_ptr<T, TDeleter>&&>(object);
+  }
+
+  template <class I, BOOST_DI_REQUIRES(aux::is_convertible<T*, I*>::value &&
+                                       !aux::is_convertible<TDeleter, std::default_delete<I>>::value &&
+                                       aux::is_move_constructible<T>::value) = 0>
+  inline operator std::unique_ptr<I, std::default_delete<I>>() noexcept {
+    return std::unique_ptr<I, std::default_delete<I>>{new T(static_cast<T&&>(*object))};
+  }
+
+  std::unique_ptr<T, TDeleter> object;
+};
+
 }  // wrappers
 
 #endif
@@ -24,7 +24,10 @@ struct fake_injector : core::injector_base {
   }
 
  protected:
-  template <class, class = no_name, class = std::false_type>
+  template <class T>
+  using context_t = T;
+
+  template <class, class = no_name, class = std::false_type, class = void>
   struct is_creatable : std::true_type {};
 
   template <class, class>
@@ -32,23 +35,23 @@ struct fake_injector : core::injector_base {
     using type = void;
   };
 
-  template <class T>
-  auto create_impl(const aux::type<T>&) const noexcept {
+  template <class T, class... TParent>
+  auto create_impl(const aux::type<T>&, const aux::type<TParent>&...) const noexcept {
     return T{};
   }
 
-  template <class TName, class T>
-  auto create_impl(const aux::type<named<TName, T>>&) const noexcept {
+  template <class TName, class T, class... TParent>
+  auto create_impl(const aux::type<named<TName, T>>&, const aux::type<TParent>&...) const noexcept {
     return T{};
   }
 
-  template <class T>
-  auto create_successful_impl(const aux::type<T>&) const noexcept {
+  template <class T, class... TParent>
+  auto create_successful_impl(const aux::type<T>&, const aux::type<TParent>&...) const noexcept {
     return T{};
   }
 
-  template <class TName, class T>
-  auto create_successful_impl(const aux::type<named<TName, T>>&) const noexcept {
+  template <class TName, class T, class... TParent>
+  auto create_successful_impl(const aux::type<named<TName, T>>&, const aux::type<TParent>&...) const noexcept {
     return T{};
   }
 };
@@ -150,6 +150,87 @@ test named_parameters_with_shared_scope = [] {
   expect(object.n1 != object.n2);
 };
 
+test contextual_bindings = [] {
+  struct c1 {
+    explicit c1(std::shared_ptr<i1> sp) : sp(sp) {}
+    std::shared_ptr<i1> sp;
+  };
+  struct c2 {
+    c2(std::shared_ptr<i1> sp, int i) : sp(sp), i(i) {}
+    std::shared_ptr<i1> sp;
+    int i = 0;
+  };
+  struct c3 {
+    c3(c1 c1_, c2 c2_, int i) : c1_(c1_), c2_(c2_), i(i) {}
+    c1 c1_;
+    c2 c2_;
+    int i = 0;
+  };
+
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<i1>().to<impl1>()
+  , di::bind<i1>().when<c2>().to<impl1_int>()
+  , di::bind<int>().to(42)
+  , di::bind<int>().when<c2>().to(87)
+  );
+  // clang-format on
+
+  auto object = injector.create<c3>();
+  expect(dynamic_cast<impl1 *>(object.c1_.sp.get()));
+  expect(dynamic_cast<impl1_int *>(object.c2_.sp.get()));
+  expect(42 == static_cast<impl1_int *>(object.c2_.sp.get())->i);
+  expect(87 == object.c2_.i);
+  expect(42 == object.i);
+  expect(42 == injector.create<int>());
+};
+
+test contextual_bindings_named = [] {
+  struct c {
+    BOOST_DI_INJECT(c, (named = a) int a, (named = b) int b, int i) : a(a), b(b), i(i) {}
+    int a = 0;
+    int b = 0;
+    int i = 0;
+  };
+  struct other {
+    BOOST_DI_INJECT(explicit other, (named = a) int a) : a(a) {}
+    int a = 0;
+  };
+
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<int>().named(a).to(1)
+  , di::bind<int>().named(a).when<c>().to(2)
+  , di::bind<int>().named(b).when<c>().to(3)
+  , di::bind<int>().when<c>().to(4)
+  );
+  // clang-format on
+
+  auto object = injector.create<c>();
+  expect(2 == object.a);
+  expect(3 == object.b);
+  expect(4 == object.i);
+  expect(1 == injector.create<other>().a);
+};
+
+test contextual_bindings_interface_parent = [] {
+  struct c {
+    explicit c(int i) : i(i) {}
+    int i = 0;
+  };
+
+  // clang-format off
+  auto injector = di::make_injector(
+    di::bind<i1>().to<impl1_int>()
+  , di::bind<int>().when<impl1_int>().to(42)
+  );
+  // clang-format on
+
+  auto object = injector.create<std::unique_ptr<i1>>();
+  expect(42 == static_cast<impl1_int *>(object.get())->i);
+  expect(0 == injector.create<c>().i);
+};
+
 test any_of = [] {
   auto injector = di::make_injector(di::bind<impl1_2>());
 
@@ -282,6 +363,75 @@ test bind_const_ref_type_in_singleton_scope = [] {
   di::make_injector().create<c>();
 };
 
+test bind_non_interface_in_injector_singleton_scope = [] {
+  struct c {};
+  auto injector1 = di::make_injector(di::bind<c>().in(di::injector_singleton));
+  auto injector2 = di::make_injector(di::bind<c>().in(di::injector_singleton));
+  expect(&injector1.create<c &>() == &injector1.create<c &>());
+  expect(&injector1.create<c &>() != &injector2.create<c &>());
+  expect(injector1.create<std::shared_ptr<c>>() == injector1.create<std::shared_ptr<c>>());
+  expect(injector1.create<std::shared_ptr<c>>() != injector2.create<std::shared_ptr<c>>());
+};
+
+test bind_interface_implementation_in_injector_singleton_scope = [] {
+  struct c {
+    c(std::shared_ptr<i1> sp1, std::shared_ptr<impl1> sp2) { expect(sp1 == sp2); }
+  };
+  auto injector = di::make_injector(di::bind<i1, impl1>().to<impl1>().in(di::injector_singleton));
+  injector.create<c>();
+};
+
+test bind_non_interface_in_concurrent_scoped_scope = [] {
+  struct c {};
+  auto injector1 = di::make_injector(di::bind<c>().in(di::concurrent_scoped));
+  auto injector2 = di::make_injector(di::bind<c>().in(di::concurrent_scoped));
+  expect(&injector1.create<c &>() == &injector1.create<c &>());
+  expect(&injector1.create<c &>() != &injector2.create<c &>());
+  expect(injector1.create<std::shared_ptr<c>>() == injector1.create<std::shared_ptr<c>>());
+  expect(injector1.create<std::shared_ptr<c>>() != injector2.create<std::shared_ptr<c>>());
+};
+
+test bind_interface_implementation_in_concurrent_scoped_scope = [] {
+  struct c {
+    c(std::shared_ptr<i1> sp1, std::shared_ptr<impl1> sp2) { expect(sp1 == sp2); }
+  };
+  auto injector = di::make_injector(di::bind<i1, impl1>().to<impl1>().in(di::concurrent_scoped));
+  injector.create<c>();
+};
+
+test bind_non_interface_in_thread_local_scope = [] {
+  struct c {};
+  auto injector1 = di::make_injector(di::bind<c>().in(di::thread_local_));
+  auto injector2 = di::make_injector(di::bind<c>().in(di::thread_local_));
+  expect(&injector1.create<c &>() == &injector1.create<c &>());
+  expect(&injector1.create<c &>() != &injector2.create<c &>());
+  expect(injector1.create<std::shared_ptr<c>>() == injector1.create<std::shared_ptr<c>>());
+  expect(injector1.create<std::shared_ptr<c>>() != injector2.create<std::shared_ptr<c>>());
+};
+
+test bind_interface_implementation_in_thread_local_scope = [] {
+  struct c {
+    c(std::shared_ptr<i1> sp1, std::shared_ptr<impl1> sp2) { expect(sp1 == sp2); }
+  };
+  auto injector = di::make_injector(di::bind<i1, impl1>().to<impl1>().in(di::thread_local_));
+  injector.create<c>();
+};
+
+test bind_interface_implementation_in_pooled_scope = [] {
+  auto injector = di::make_injector(di::bind<i1>().to<impl1>().in(di::pooled));
+  i1* ptr = nullptr;
+  {
+    auto object = injector.create<std::unique_ptr<i1, di::pool_return_deleter>>();
+    expect(dynamic_cast<impl1 *>(object.get()));
+    ptr = object.get();
+  }
+  const auto statistics = di::pooled.statistics<impl1>();
+  auto object = injector.create<std::unique_ptr<i1, di::pool_return_deleter>>();
+  expect(ptr == object.get());
+  expect(statistics.hits + 1 == di::pooled.statistics<impl1>().hits);
+  expect(statistics.misses == di::pooled.statistics<impl1>().misses);
+};
+
 test bind_shared_ptr_ref = [] {
   struct c {
     c(std::shared_ptr<int> &sp1, std::shared_ptr<int> &sp2) { expect(sp1 == sp2); }
@@ -567,6 +717,39 @@ test runtime_factory_call_operator_impl = [] {
   }
 };
 
+test runtime_one_of = [] {
+  struct value {
+    int get() const { return 0; }
+  };
+  struct value_int {
+    explicit value_int(int i) : i(i) {}
+    int get() const { return i; }
+    int i = 0;
+  };
+  using one_of = di::one_of<value, value_int>;
+  struct c {
+    explicit c(one_of object) : object(static_cast<one_of &&>(object)) {}
+    one_of object;
+  };
+
+  auto id = 1;
+  auto injector = di::make_injector(di::bind<int>().to(42), di::bind<one_of>().to<one_of>([&] { return id; }));
+
+  {
+    auto object = injector.create<c>();
+    expect(1 == object.object.index());
+    expect(42 == object.object.visit([](const auto &value) { return value.get(); }));
+  }
+
+  id = 0;
+
+  {
+    auto object = injector.create<one_of>();
+    expect(object.get_if<value>());
+    expect(0 == object.visit([](const auto &value) { return value.get(); }));
+  }
+};
+
 test scopes_injector_lambda_injector = [] {
   constexpr double d = 42.0;
   auto injector = di::make_injector(di::bind<double>().to(d), di::bind<int>().to([](const auto &injector) {
@@ -88,6 +88,23 @@ test inject_traits_no_limits_via_ctor_traits = [] {
   injector.create<c_no_limits>();
 };
 
+struct c_ctor_limit {
+  c_ctor_limit(int, int, int, int, int, int, int, int, int, int, int, int) {}
+};
+
+namespace boost {
+namespace di {
+
+template <>
+struct ctor_limit<c_ctor_limit> : aux::integral_constant<int, 12> {};
+}
+}  // boost::di
+
+test ctor_limit_via_ctor_limit = [] {
+  auto injector = di::make_injector();
+  injector.create<c_ctor_limit>();
+};
+
 test inject = [] {
   constexpr auto i = 42;
 
@@ -498,6 +515,22 @@ test conversion_to_boost_shared_ctor_referable = [] {
   expect(i == *object.sp);
 };
 
+test conversion_to_boost_shared_ptr_shared_owner = [] {
+  struct c {
+    boost::shared_ptr<int> sp;
+    boost::shared_ptr<double> dp;
+  };
+
+  auto injector = di::make_injector(di::bind<int>().in(di::singleton), di::bind<double>().to(std::make_shared<double>(87.0)));
+  auto object1 = injector.create<c>();
+  auto object2 = injector.create<c>();
+
+  expect(object1.sp == object2.sp);
+  expect(!object1.sp.owner_before(object2.sp) && !object2.sp.owner_before(object1.sp));
+  expect(87.0 == *object2.dp);
+  expect(!object1.dp.owner_before(object2.dp) && !object2.dp.owner_before(object1.dp));
+};
+
 test conversion_to_boost_shared_ptr_uniform = [] {
   struct c {
     boost::shared_ptr<int> sp;
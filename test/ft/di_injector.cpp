@@ -12,6 +12,11 @@
 #include <set>
 #include <vector>
 #include <iterator>
+#include <type_traits>
+#if __has_include(<boost / intrusive_ptr.hpp>)
+#include <boost/intrusive_ptr.hpp>
+#include <boost/smart_ptr/intrusive_ref_counter.hpp>
+#endif
 
 namespace di = boost::di;
 
@@ -237,6 +242,20 @@ test exposed_move = [] {
   expect(i == object->i);
 };
 
+test exposed_move_injector_singleton = [] {
+  struct c {
+    int i = 0;
+  };
+
+  di::injector<c&> injector = di::make_injector(di::bind<c>().in(di::injector_singleton));
+  auto& object = injector.create<c&>();
+  object.i = 42;
+
+  auto moved = std::move(injector);
+  expect(&object == &moved.create<c&>());
+  expect(42 == moved.create<c&>().i);
+};
+
 test exposed_many = [] {
   constexpr auto i = 42;
   auto injector1 = []() -> di::injector<complex1, std::shared_ptr<i1>> {
@@ -425,3 +444,344 @@ test exposed_by_lambda_expr_and_func = [] {
   auto injector = di::make_injector(m1(), m2());
   injector.create<c>();
 };
+
+struct extern_app {
+  extern_app(int i, std::shared_ptr<i1> sp) : i(i), sp(sp) {}
+  int i = 0;
+  std::shared_ptr<i1> sp;
+};
+
+auto make_extern_injector() { return di::make_injector(di::bind<int>().to(42), di::bind<i1>().to<impl1>()); }
+using extern_injector = decltype(make_extern_injector());
+using extern_exposed_injector = di::injector<int, std::shared_ptr<i1>>;
+
+BOOST_DI_EXTERN_CREATE(extern_injector, extern_app);
+BOOST_DI_EXTERN_CREATE(extern_exposed_injector, std::unique_ptr<extern_app>);
+
+static_assert(di::core::extern_create<di::core::injector_t<extern_injector>, extern_app>::value, "");
+static_assert(!di::core::extern_create<di::core::injector_t<extern_injector>, int>::value, "");
+
+test create_n = [] {
+  struct worker {
+    worker(std::shared_ptr<i1> sp, int i) : sp(sp), i(i) {}
+    std::shared_ptr<i1> sp;
+    int i = 0;
+  };
+
+  auto injector = di::make_injector(di::bind<i1>().to<impl1>().in(di::singleton), di::bind<int>().to(42));
+  auto objects = injector.create_n<worker>(4);
+  expect(4 == objects.size());
+  expect(&objects[0] + 3 == &objects[3]);
+  expect(dynamic_cast<impl1*>(objects[0].sp.get()));
+  for (const auto& object : objects) {
+    expect(object.sp == objects[0].sp);
+    expect(42 == object.i);
+  }
+};
+
+test create_n_empty = [] {
+  auto objects = di::make_injector().create_n<int>(0);
+  expect(objects.empty());
+  expect(objects.begin() == objects.end());
+};
+
+test create_n_unique = [] {
+  struct c {
+    explicit c(std::unique_ptr<i1> up) : up(std::move(up)) {}
+    std::unique_ptr<i1> up;
+  };
+
+  auto injector = di::make_injector(di::bind<i1>().to<impl1>());
+  auto objects = injector.create_n<c>(2);
+  expect(objects[0].up != objects[1].up);
+};
+
+test create_into = [] {
+  static auto dtor_calls = 0;
+  struct c {
+    explicit c(int i) : i(i) {}
+    ~c() { ++dtor_calls; }
+    int i = 0;
+  };
+
+  auto injector = di::make_injector(di::bind<int>().to(87));
+  alignas(c) unsigned char buffer[3 * sizeof(c)];
+  c* objects = injector.create_into<c>(buffer, 3);
+  expect(static_cast<void*>(objects) == static_cast<void*>(buffer));
+  dtor_calls = 0;
+  for (auto i = 0; i < 3; ++i) {
+    expect(87 == objects[i].i);
+    objects[i].~c();
+  }
+  expect(3 == dtor_calls);
+};
+
+test create_at = [] {
+  static auto ctor_calls = 0;
+  struct c {
+    explicit c(int i) : i(i) { ++ctor_calls; }
+    c(c&&) { ++ctor_calls; }
+    int i = 0;
+  };
+
+  auto injector = di::make_injector(di::bind<int>().to(42));
+  alignas(c) unsigned char buffer[sizeof(c)];
+  c& object = injector.create_at<c>(buffer);
+  expect(static_cast<void*>(&object) == static_cast<void*>(buffer));
+  expect(42 == object.i);
+  expect(1 == ctor_calls);
+  object.~c();
+};
+
+test create_at_interface = [] {
+  auto injector = di::make_injector(di::bind<i1>().to<impl1>());
+  alignas(impl1) unsigned char buffer[sizeof(impl1)];
+  i1& object = injector.create_at<i1>(buffer);
+  expect(dynamic_cast<impl1*>(&object));
+  expect(static_cast<void*>(dynamic_cast<impl1*>(&object)) == static_cast<void*>(buffer));
+  object.~i1();
+};
+
+test create_at_storage = [] {
+  auto injector = di::make_injector(di::bind<i1>().to<impl1>());
+  using storage_t = decltype(injector)::storage_t<i1>;
+  static_expect(sizeof(storage_t) == sizeof(impl1));
+  static_expect(alignof(storage_t) == alignof(impl1));
+
+  storage_t storage;
+  i1& object = injector.create_at<i1>(&storage);
+  expect(static_cast<void*>(dynamic_cast<impl1*>(&object)) == static_cast<void*>(&storage));
+  object.~i1();
+};
+
+static auto new_calls = 0;
+
+struct new_provider {
+  template <class...>
+  struct is_creatable {
+    static constexpr auto value = true;
+  };
+
+  template <class T, class TMemory, class... TArgs>
+  auto get(const di::type_traits::direct&, const TMemory&, TArgs&&... args) const {
+    ++new_calls;
+    return new T(static_cast<TArgs&&>(args)...);
+  }
+
+  template <class T, class TMemory, class... TArgs>
+  auto get(const di::type_traits::uniform&, const TMemory&, TArgs&&... args) const {
+    ++new_calls;
+    return new T{static_cast<TArgs&&>(args)...};
+  }
+};
+
+test create_at_custom_provider = [] {
+  struct c {
+    explicit c(int i) : i(i) {}
+    int i = 0;
+  };
+
+  struct config : di::config {
+    static auto provider(...) noexcept { return new_provider{}; }
+  };
+
+  new_calls = 0;
+  auto injector = di::make_injector<config>(di::bind<int>().to(42));
+  decltype(injector)::storage_t<c> storage;
+  c& object = injector.create_at<c>(&storage);
+  expect(static_cast<void*>(&object) == static_cast<void*>(&storage));
+  expect(42 == object.i);
+  expect(0 == new_calls);
+  object.~c();
+};
+
+test create_poly = [] {
+  struct impl : i1 {
+    explicit impl(int i) : i(i) {}
+    void dummy1() override {}
+    int i = 0;
+  };
+
+  struct big : impl {
+    using impl::impl;
+    char data[64];
+  };
+
+  struct c {
+    explicit c(di::poly<i1, 16> object) : object(std::move(object)) {}
+    di::poly<i1, 16> object;
+  };
+
+  auto injector = di::make_injector(di::bind<i1>().to<impl>(), di::bind<int>().to(42));
+  auto object = injector.create<c>();
+  expect(object.object.inlined());
+  expect(42 == static_cast<impl*>(object.object.get())->i);
+
+  auto injector_ = di::make_injector(di::bind<i1>().to<big>(), di::bind<int>().to(87));
+  auto object_ = injector_.create<di::poly<i1, 16>>();
+  expect(!object_.inlined());
+  expect(87 == static_cast<big*>(object_.get())->i);
+};
+
+test create_poly_heap_provider = [] {
+  struct config : di::config {
+    static auto provider(...) noexcept { return di::providers::heap{}; }
+  };
+
+  auto injector = di::make_injector<config>(di::bind<i1>().to<impl1>());
+  auto object = injector.create<di::poly<i1, 16>>();
+  expect(!object.inlined());
+  expect(dynamic_cast<impl1*>(object.get()));
+};
+
+test create_shared_ptr_unique = [] {
+  struct aggregate {
+    int i = 0;
+    double d = 0.0;
+  };
+
+  auto injector = di::make_injector(di::bind<i1>().to<impl1>().in(di::unique), di::bind<aggregate>().in(di::unique),
+                                    di::bind<int>().to(42));
+  std::shared_ptr<i1> object = injector.create<std::shared_ptr<i1>>();
+  expect(dynamic_cast<impl1*>(object.get()));
+  expect(1 == object.use_count());
+  expect(object != injector.create<std::shared_ptr<i1>>());
+
+  auto aggregate_ = injector.create<std::shared_ptr<aggregate>>();
+  expect(42 == aggregate_->i);
+  expect(1 == aggregate_.use_count());
+};
+
+test create_borrowed = [] {
+  struct c {
+    c(di::borrowed<i1> object, std::shared_ptr<i1> sp, di::borrowed<const int> i) : object(object), sp(sp), i(i) {}
+    di::borrowed<i1> object;
+    std::shared_ptr<i1> sp;
+    di::borrowed<const int> i;
+  };
+
+  auto i = 42;
+  auto injector = di::make_injector(di::bind<i1>().to<impl1>(), di::bind<int>().to(i));
+  auto object = injector.create<c>();
+  expect(dynamic_cast<impl1*>(object.object.get()));
+  expect(object.sp.get() == object.object.get());
+  expect(injector.create<di::borrowed<i1>>().get() == object.object.get());
+  expect(&i == object.i.get());
+};
+
+test create_sealed = [] {
+  struct interface {
+    virtual ~interface() noexcept = default;
+    virtual int get() const = 0;
+  };
+  struct implementation final : interface {
+    explicit implementation(int i) : i(i) {}
+    int get() const override { return i; }
+    int i = 0;
+  };
+  struct mock : interface {
+    int get() const override { return 87; }
+  };
+  struct c {
+    c(di::sealed<interface, implementation> object1, di::sealed<interface> object2)
+        : object1(static_cast<di::sealed<interface, implementation>&&>(object1)),
+          object2(static_cast<di::sealed<interface>&&>(object2)) {}
+    di::sealed<interface, implementation> object1;
+    di::sealed<interface> object2;
+  };
+
+  auto injector = di::make_injector(di::bind<interface>().to<implementation>(), di::bind<int>().to(42));
+  static_expect(std::is_same<di::sealed<interface, implementation>, di::sealed_t<decltype(injector), interface>>::value);
+  auto object = injector.create<c>();
+  expect(42 == object.object1->get());
+  expect(42 == object.object2->get());
+  expect(dynamic_cast<implementation*>(object.object2.get()));
+
+  auto mock_injector = di::make_injector(di::bind<interface>().to<mock>());
+  static_expect(std::is_same<di::sealed<interface, mock>, di::sealed_t<decltype(mock_injector), interface>>::value);
+  expect(87 == mock_injector.create<di::sealed<interface>>()->get());
+
+  static_expect(std::is_same<di::sealed<interface>, di::sealed_t<decltype(di::make_injector()), interface>>::value);
+};
+
+template <class T>
+class counted_ptr {
+ public:
+  explicit counted_ptr(T* object) noexcept : object_(object) { ++object_->references; }
+  counted_ptr(const counted_ptr& other) noexcept : counted_ptr(other.object_) {}
+  counted_ptr& operator=(const counted_ptr&) = delete;
+  ~counted_ptr() noexcept {
+    if (!--object_->references) {
+      delete object_;
+    }
+  }
+
+  T* get() const noexcept { return object_; }
+
+ private:
+  T* object_ = nullptr;
+};
+
+namespace boost {
+namespace di {
+template <class T>
+struct smart_ptr_traits<counted_ptr<T>> {
+  using element_type = T;
+};
+}  // di
+}  // boost
+
+test create_user_smart_ptr = [] {
+  struct counted {
+    virtual ~counted() noexcept = default;
+    int references = 0;
+  };
+  struct counted_impl : counted {
+    explicit counted_impl(int i) : i(i) {}
+    int i = 0;
+  };
+  struct c {
+    c(counted_ptr<counted> object1, counted_ptr<counted> object2) : object1(object1), object2(object2) {}
+    counted_ptr<counted> object1;
+    counted_ptr<counted> object2;
+  };
+
+  auto injector = di::make_injector(di::bind<counted>().to<counted_impl>(), di::bind<int>().to(42));
+  auto object = injector.create<c>();
+  expect(object.object1.get() != object.object2.get());
+  expect(1 == object.object1.get()->references);
+  expect(42 == static_cast<counted_impl*>(object.object1.get())->i);
+};
+
+#if __has_include(<boost / intrusive_ptr.hpp>)
+test create_intrusive_ptr = [] {
+  struct counted : boost::intrusive_ref_counter<counted, boost::thread_unsafe_counter> {
+    virtual ~counted() noexcept = default;
+  };
+  struct counted_impl : counted {};
+
+  auto injector = di::make_injector(di::bind<counted>().to<counted_impl>());
+  auto object = injector.create<boost::intrusive_ptr<counted>>();
+  expect(dynamic_cast<counted_impl*>(object.get()));
+  expect(1 == object->use_count());
+  expect(object != injector.create<boost::intrusive_ptr<counted>>());
+};
+#endif
+
+test extern_create = [] {
+  auto injector = make_extern_injector();
+  auto object = injector.create<extern_app>();
+  expect(42 == object.i);
+  expect(dynamic_cast<impl1*>(object.sp.get()));
+  expect(42 == injector.create<int>());
+};
+
+test extern_create_exposed = [] {
+  extern_exposed_injector injector = di::make_injector(di::bind<int>().to(87), di::bind<i1>().to<impl1>());
+  auto object = injector.create<std::unique_ptr<extern_app>>();
+  expect(87 == object->i);
+  expect(dynamic_cast<impl1*>(object->sp.get()));
+};
+
+BOOST_DI_INSTANTIATE_CREATE(extern_injector, extern_app)
+BOOST_DI_INSTANTIATE_CREATE(extern_exposed_injector, std::unique_ptr<extern_app>)
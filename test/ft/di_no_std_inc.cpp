@@ -23,4 +23,7 @@ int main() {
 
   auto injector = di::make_injector(di::bind<int>().to(42), di::bind<i1>().to<impl1>());
   injector.create<c>();
+  injector.create_n<c>(2);
+  alignas(c) unsigned char buffer[sizeof(c)];
+  injector.create_at<c>(buffer);
 }
@@ -0,0 +1,24 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#define BOOST_DI_CFG_VALIDATE_BINDINGS 0
+#include <type_traits>
+#include "boost/di.hpp"
+
+namespace di = boost::di;
+
+test bindings_are_not_validated = [] {
+  using dependency = decltype(di::bind<int>().to(42));
+  static_expect(std::is_same<di::aux::true_type, di::concepts::boundable<di::aux::type<dependency, dependency>>>::value);
+  static_expect(
+      std::is_same<di::aux::true_type, di::concepts::boundable<di::aux::type_list<dependency, dependency, dependency>>>::value);
+};
+
+test bind_and_create_without_validation = [] {
+  auto injector = di::make_injector(di::bind<int>().to(42), di::bind<double>().to(87.0));
+  expect(42 == injector.create<int>());
+  expect(87.0 == injector.create<double>());
+};
@@ -10,7 +10,15 @@
 #include <sstream>
 #include <cstdlib>
 #include <chrono>
+#include <initializer_list>
 #include <regex>
+#include <map>
+#include <algorithm>
+#if defined(__linux)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 #include "common/utils.hpp"
 
 namespace {
@@ -26,12 +34,13 @@ class generator {
   enum class config_create { CTOR, INJECT };
   enum class config_configure { ALL, EXPOSED };
 
-  generator(config_create create, config_configure configure, bool interfaces = false, int modules = 0)
+  generator(config_create create, config_configure configure, bool interfaces = false, int modules = 0, int types = MAX_TYPES)
       : create_(create),
         configure_(configure),
         interfaces_(interfaces),
         modules_(modules),
-        source_code_(gen_name(create, configure, interfaces, modules)) {}
+        types_(types),
+        source_code_(gen_name(create, configure, interfaces, modules, types)) {}
 
   std::string generate() {
     gen_header();
@@ -48,10 +57,32 @@ class generator {
   }
 
  private:
-  std::string gen_name(config_create create, config_configure configure, bool interfaces, int modules) const {
+  std::string gen_name(config_create create, config_configure configure, bool interfaces, int modules, int types) const {
     std::stringstream name;
     name << SOURCE_FILE << "_" << static_cast<int>(create) << "_" << static_cast<int>(configure) << "_" << interfaces << "_"
-         << modules << ".cpp";
+         << modules;
+    if (types != MAX_TYPES) {
+      name << "_" << types;
+    }
+    name << ".cpp";
+    return name.str();
+  }
+
+  int complex_types(int level) const {
+    auto n = types_;
+    for (auto i = 0; i <= level; ++i) {
+      n = (n + MAX_COMPLEX_TYPES - 1) / MAX_COMPLEX_TYPES;
+    }
+    return n;
+  }
+
+  std::string complex_type(int level, int i) const {
+    std::stringstream name;
+    name << "c";
+    if (level) {
+      name << level << "_";
+    }
+    name << i;
     return name.str();
   }
 
@@ -93,20 +124,21 @@ class generator {
     if (constructor == "") {
       return args.str();
     }
+    const auto first = (i / MAX_TYPES) * MAX_TYPES;
     for (auto j = i - MAX_CTOR_ARGS; j < i; ++j) {
-      if (j >= 0) {
-        args << (j > 0 && j != i - MAX_CTOR_ARGS ? "," : "") << constructor << std::setfill('0') << std::setw(2) << j;
+      if (j >= first) {
+        args << (j > first && j != i - MAX_CTOR_ARGS ? "," : "") << constructor << std::setfill('0') << std::setw(2) << j;
       }
     }
     return args.str();
   };
 
   void gen_basic_types(const std::string& name, const std::string& constructor, const std::string& base = "") {
-    for (auto i = 0; i < MAX_TYPES; ++i) {
+    for (auto i = 0; i < types_; ++i) {
       std::stringstream ctor;
 
       if (create_ == config_create::INJECT) {
-        ctor << "BOOST_DI_INJECT(" << name << std::setfill('0') << std::setw(2) << i << (i ? ", " : "")
+        ctor << "BOOST_DI_INJECT(" << name << std::setfill('0') << std::setw(2) << i << (i % MAX_TYPES ? ", " : "")
              << gen_ctor_args(constructor, i) << ") { }";
       } else {
         ctor << name << std::setfill('0') << std::setw(2) << i << "(" << gen_ctor_args(constructor, i) << ") { }";
@@ -118,15 +150,15 @@ class generator {
   }
 
   void gen_complex_types() {
-    for (auto i = 0; i < MAX_COMPLEX_TYPES; ++i) {
-      source_code_ << "struct c" << i << "{";
+    for (auto i = 0; i < complex_types(0); ++i) {
+      source_code_ << "struct " << complex_type(0, i) << "{";
       if (create_ == config_create::INJECT) {
-        source_code_ << "BOOST_DI_INJECT(c" << i;
+        source_code_ << "BOOST_DI_INJECT(" << complex_type(0, i);
       } else {
-        source_code_ << "c" << i << "(";
+        source_code_ << complex_type(0, i) << "(";
       }
 
-      for (auto j = 0; j < MAX_COMPLEX_TYPES; ++j) {
+      for (auto j = 0; j < MAX_COMPLEX_TYPES && (i * MAX_COMPLEX_TYPES) + j < types_; ++j) {
         source_code_ << (j || create_ == config_create::INJECT ? ", " : "") << (interfaces_ ? "std::unique_ptr<" : "")
                      << (interfaces_ ? ((i * MAX_COMPLEX_TYPES) + j < modules_ * MAX_COMPLEX_TYPES ? "i" : "impl") : "x")
                      << std::setfill('0') << std::setw(2) << (i * MAX_COMPLEX_TYPES) + j << (interfaces_ ? ">" : "");
@@ -134,23 +166,34 @@ class generator {
       source_code_ << ") { } };\n";
     }
 
+    auto level = 0;
+    for (; complex_types(level) > MAX_COMPLEX_TYPES; ++level) {
+      for (auto i = 0; i < complex_types(level + 1); ++i) {
+        gen_complex_type(complex_type(level + 1, i), level, i * MAX_COMPLEX_TYPES,
+                         std::min((i + 1) * MAX_COMPLEX_TYPES, complex_types(level)));
+      }
+    }
+    gen_complex_type("c", level, 0, complex_types(level));
+  }
+
+  void gen_complex_type(const std::string& name, int level, int first, int last) {
     if (create_ == config_create::INJECT) {
-      source_code_ << "struct c { BOOST_DI_INJECT(c, ";
+      source_code_ << "struct " << name << " { BOOST_DI_INJECT(" << name << ", ";
     } else {
-      source_code_ << "struct c { c(";
+      source_code_ << "struct " << name << " { " << name << "(";
     }
 
-    for (auto i = 0; i < MAX_COMPLEX_TYPES; ++i) {
-      source_code_ << (i ? ", " : "") << "c" << i;
+    for (auto i = first; i < last; ++i) {
+      source_code_ << (i != first ? ", " : "") << complex_type(level, i);
     }
     source_code_ << ") { } };\n";
   }
 
   void gen_modules() {
     for (auto i = 0; i < MAX_MODULES; ++i) {
-      if (i < modules_) {
+      if (i < modules_ && i < complex_types(0)) {
         if (configure_ == config_configure::EXPOSED) {
-          source_code_ << "di::injector<c" << i << "> ";
+          source_code_ << "di::injector<" << complex_type(0, i) << "> ";
         } else {
           source_code_ << "auto ";
         }
@@ -158,14 +201,14 @@ class generator {
         source_code_ << "\tauto i = di::make_injector(\n";
 
         if (interfaces_) {
-          for (auto j = 0; j < MAX_MODULES; ++j) {
+          for (auto j = 0; j < MAX_MODULES && j + (i * MAX_MODULES) < types_; ++j) {
             source_code_ << "\t" << (j ? ", " : "  ") << "di::bind<i" << std::setfill('0') << std::setw(2)
                          << j + (i * MAX_MODULES) << ">().to<impl" << std::setfill('0') << std::setw(2) << j + (i * MAX_MODULES)
                          << ">()\n";
           }
         }
 
-        for (auto j = 0; j < MAX_MODULES; ++j) {
+        for (auto j = 0; j < MAX_MODULES && j + (i * MAX_MODULES) < types_; ++j) {
           source_code_ << "\t\t" << (j || interfaces_ ? ", " : "  ") << "di::bind<x" << std::setfill('0') << std::setw(2)
                        << j + (i * MAX_MODULES) << ">().in(di::unique)\n";
         }
@@ -183,7 +226,7 @@ class generator {
     source_code_ << "int main() {\n";
     source_code_ << "\tauto injector = di::make_injector(\n";
     for (auto i = 0; i < MAX_MODULES; ++i) {
-      if (i < modules_) {
+      if (i < modules_ && i < complex_types(0)) {
         source_code_ << "\t\t" << (i ? ", " : "  ") << "module" << i << "()\n";
       }
     }
@@ -195,6 +238,145 @@ class generator {
   config_configure configure_;
   bool interfaces_ = false;
   int modules_ = 0;
+  int types_ = MAX_TYPES;
+  file<> source_code_;
+};
+
+class bindings_generator {
+  static constexpr auto SOURCE_FILE = "benchmark_bindings";
+  static constexpr auto MAX_BINDINGS_PER_MODULE = 64;
+
+ public:
+  explicit bindings_generator(int bindings) : bindings_(bindings), source_code_(gen_name(bindings)) {}
+
+  std::string generate() {
+    source_code_ << "#include <boost/di.hpp>\n";
+    source_code_ << "namespace di = boost::di;\n";
+    for (auto i = 0; i < bindings_; ++i) {
+      source_code_ << "struct x" << i << " { };\n";
+    }
+    gen_modules();
+    gen_main();
+
+    return source_code_;
+  }
+
+ private:
+  std::string gen_name(int bindings) const {
+    std::stringstream name;
+    name << SOURCE_FILE << "_" << bindings << ".cpp";
+    return name.str();
+  }
+
+  int modules() const { return (bindings_ + MAX_BINDINGS_PER_MODULE - 1) / MAX_BINDINGS_PER_MODULE; }
+
+  void gen_modules() {
+    for (auto i = 0; i < modules(); ++i) {
+      source_code_ << "auto module" << i << "() noexcept {\n";
+      source_code_ << "\treturn di::make_injector(\n";
+      for (auto j = i * MAX_BINDINGS_PER_MODULE; j < bindings_ && j < (i + 1) * MAX_BINDINGS_PER_MODULE; ++j) {
+        source_code_ << "\t\t" << (j % MAX_BINDINGS_PER_MODULE ? ", " : "  ") << "di::bind<x" << j << ">().in(di::unique)\n";
+      }
+      source_code_ << "\t);\n}\n";
+    }
+  }
+
+  void gen_main() {
+    source_code_ << "int main() {\n";
+    source_code_ << "\tauto injector = di::make_injector(\n";
+    for (auto i = 0; i < modules(); ++i) {
+      source_code_ << "\t\t" << (i ? ", " : "  ") << "module" << i << "()\n";
+    }
+    source_code_ << "\t);\n\tinjector.create<x0>();\n}\n\n";
+  }
+
+  int bindings_ = 0;
+  file<> source_code_;
+};
+
+class ctor_generator {
+  static constexpr auto SOURCE_FILE = "benchmark_ctor";
+  static constexpr auto MAX_TYPES = 100;
+
+ public:
+  enum class config_ctor { CTOR, CTOR_LIMIT, AGGREGATE, INJECT, CTOR_LEGACY, AGGREGATE_LEGACY };
+
+  explicit ctor_generator(int ctor_args, config_ctor ctor = config_ctor::CTOR, int types = MAX_TYPES)
+      : ctor_args_(ctor_args), ctor_(ctor), types_(types), source_code_(gen_name(ctor_args, ctor, types)) {}
+
+  std::string generate() {
+    source_code_ << "#include <boost/di.hpp>\n";
+    source_code_ << "namespace di = boost::di;\n";
+    for (auto i = 0; i < types_; ++i) {
+      source_code_ << "struct x" << i << " { " << gen_ctor(i, i % (ctor_args_ + 1)) << " };\n";
+    }
+    if (ctor_ == config_ctor::CTOR_LIMIT) {
+      source_code_ << "namespace boost { namespace di {\n";
+      for (auto i = 0; i < types_; ++i) {
+        source_code_ << "template <> struct ctor_limit<x" << i << "> : aux::integral_constant<int, " << i % (ctor_args_ + 1)
+                     << "> { };\n";
+      }
+      source_code_ << "}}\n";
+    }
+    if (ctor_ == config_ctor::CTOR_LEGACY || ctor_ == config_ctor::AGGREGATE_LEGACY) {
+      gen_legacy_ctor_traits();
+    }
+    source_code_ << "int main() {\n";
+    source_code_ << "\tauto injector = di::make_injector();\n";
+    for (auto i = 0; i < types_; ++i) {
+      source_code_ << "\tinjector.create<x" << i << ">();\n";
+    }
+    source_code_ << "}\n\n";
+
+    return source_code_;
+  }
+
+ private:
+  std::string gen_name(int ctor_args, config_ctor ctor, int types) const {
+    std::stringstream name;
+    name << SOURCE_FILE << "_" << ctor_args << "_" << static_cast<int>(ctor) << "_" << types << ".cpp";
+    return name.str();
+  }
+
+  // probes all arities downwards, with parens and then with braces (deduction before ctor_uniform/ctor_args)
+  void gen_legacy_ctor_traits() {
+    source_code_ << "namespace boost { namespace di {\n";
+    source_code_ << "template <class T> using legacy_ctor_seq = aux::make_index_sequence<BOOST_DI_CFG_CTOR_LIMIT_SIZE>;\n";
+    source_code_ << "template <class T, class TArgs = typename type_traits::ctor_impl<aux::is_constructible, T, "
+                    "legacy_ctor_seq<T>>::type>\n";
+    source_code_ << "struct legacy_ctor : aux::pair<type_traits::direct, TArgs> { };\n";
+    source_code_ << "template <class T> struct legacy_ctor<T, aux::type_list<>> : aux::pair<type_traits::uniform, "
+                    "typename type_traits::ctor_impl<aux::is_braces_constructible, T, legacy_ctor_seq<T>>::type> { };\n";
+    for (auto i = 0; i < types_; ++i) {
+      source_code_ << "template <> struct ctor_traits<x" << i << "> : legacy_ctor<x" << i << "> { };\n";
+    }
+    source_code_ << "}}\n";
+  }
+
+  std::string gen_ctor(int i, int args) const {
+    std::stringstream ctor;
+    if (ctor_ == config_ctor::AGGREGATE || ctor_ == config_ctor::AGGREGATE_LEGACY) {
+      for (auto j = 0; j < args; ++j) {
+        ctor << "int i" << j << "; ";
+      }
+      return ctor.str();
+    }
+
+    if (ctor_ == config_ctor::INJECT) {
+      ctor << "BOOST_DI_INJECT(x" << i << (args ? ", " : "");
+    } else {
+      ctor << "x" << i << "(";
+    }
+    for (auto j = 0; j < args; ++j) {
+      ctor << (j ? ", " : "") << "int";
+    }
+    ctor << ") { }";
+    return ctor.str();
+  }
+
+  int ctor_args_ = 0;
+  config_ctor ctor_ = config_ctor::CTOR;
+  int types_ = 0;
   file<> source_code_;
 };
 
@@ -206,7 +388,7 @@ class json {
   },
   "xAxis": {
     "title": {
-      "text": "Number of bindings"
+      "text": "%xaxis%"
     },
     "floor": 0
   },
@@ -226,8 +408,11 @@ class json {
 )";
 
  public:
-  explicit json(const std::string& name) : file_{name + "_" + cxx() + ".json"} {
-    file_ << std::regex_replace(std::string{header}, std::regex{"%title%"}, name + " complexity | " + cxx() + " " + cxxflags());
+  explicit json(const std::string& name, const std::string& xaxis = "Number of bindings")
+      : file_{name + "_" + cxx() + ".json"} {
+    file_ << std::regex_replace(
+        std::regex_replace(std::string{header}, std::regex{"%title%"}, name + " complexity | " + cxx() + " " + cxxflags()),
+        std::regex{"%xaxis%"}, xaxis);
   }
 
   ~json() { file_ << footer; }
@@ -266,9 +451,9 @@ class series {
   json& data_;
 };
 
-auto measure(const std::string& file) {
+auto measure(const std::string& file, const std::string& flags = "") {
   std::stringstream command;
-  command << cxx() << " " << cxxflags(true) << " " << file;
+  command << cxx() << " " << cxxflags(true) << " " << flags << " " << file;
 
   auto start = std::chrono::high_resolution_clock::now();
   auto result = std::system(command.str().c_str());
@@ -278,6 +463,157 @@ auto measure(const std::string& file) {
   return std::chrono::duration<double>(end - start).count();
 }
 
+struct stats {
+  double time = 0;
+  double frontend = 0;
+  double instantiation = 0;
+  long instantiations = 0;
+  long rss = 0;
+  long object = 0;
+};
+
+auto execute(const std::string& command, long& rss) {
+#if defined(__linux)
+  auto pid = fork();
+  if (!pid) {
+    execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+    _exit(127);
+  }
+  auto status = 0;
+  rusage usage{};
+  wait4(pid, &status, 0, &usage);
+  rss = usage.ru_maxrss;
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#else
+  rss = 0;
+  return std::system(command.c_str());
+#endif
+}
+
+auto file_size(const std::string& file) -> long {
+  std::ifstream in{file, std::ios::binary | std::ios::ate};
+  return in ? static_cast<long>(in.tellg()) : 0;
+}
+
+auto read_file(const std::string& file) {
+  std::ifstream in{file};
+  return std::string{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+}
+
+void parse_time_trace(const std::string& trace, stats& result) {
+  static const std::regex total{R"re("dur":(\d+),"name":"Total (\w+)","args":\{"count":(\d+))re"};
+  for (auto it = std::sregex_iterator{trace.begin(), trace.end(), total}; it != std::sregex_iterator{}; ++it) {
+    const auto dur = std::stod((*it)[1]) / 1000000.0;
+    const auto name = (*it)[2].str();
+    if (name == "Frontend") {
+      result.frontend = dur;
+    } else if (name == "PerformPendingInstantiations") {
+      result.instantiation = dur;
+    } else if (name == "InstantiateClass" || name == "InstantiateFunction") {
+      result.instantiations += std::stol((*it)[3]);
+    }
+  }
+}
+
+void parse_time_report(const std::string& report, stats& result) {
+  static const std::regex phase{R"(^ (phase parsing|phase lang\. deferred|template instantiation) *: *)"
+                                R"([\d.]+ *\( *\d+%\) *[\d.]+ *\( *\d+%\) *([\d.]+))"};
+  std::stringstream lines{report};
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::smatch match;
+    if (std::regex_search(line, match, phase)) {
+      const auto wall = std::stod(match[2]);
+      if (match[1] == "template instantiation") {
+        result.instantiation = wall;
+      } else {
+        result.frontend += wall;
+      }
+    }
+  }
+}
+
+auto measure_stats(const std::string& file) {
+  const auto clang = cxx().find("clang") != std::string::npos;
+  const auto object = file + ".o";
+  const auto report = file + ".report";
+  std::stringstream command;
+  command << cxx() << " " << cxxflags(true) << " -c -o " << object << " " << (clang ? "-ftime-trace " : "-ftime-report ")
+          << file << " 2> " << report;
+
+  stats result{};
+  auto start = std::chrono::high_resolution_clock::now();
+  auto status = execute(command.str(), result.rss);
+  auto end = std::chrono::high_resolution_clock::now();
+  expect(!status);
+
+  result.time = std::chrono::duration<double>(end - start).count();
+  result.object = file_size(object);
+  if (clang) {
+    parse_time_trace(read_file(file + ".json"), result);
+  } else {
+    parse_time_report(read_file(report), result);
+  }
+  return result;
+}
+
+class results {
+ public:
+  explicit results(const std::string& name) : file_{name + "_" + cxx() + "_results.json"} { file_ << "["; }
+
+  ~results() { file_ << "\n]\n"; }
+
+  void add(const std::string& name, int n, const stats& s) {
+    file_ << (count_++ ? ",\n" : "\n") << "  {\"name\": \"" << name << "\", \"types\": " << n << ", \"time\": " << s.time
+          << ", \"frontend\": " << s.frontend << ", \"instantiation\": " << s.instantiation
+          << ", \"instantiations\": " << s.instantiations << ", \"rss\": " << s.rss << ", \"object\": " << s.object << "}";
+    file_.flush();
+  }
+
+ private:
+  int count_ = 0;
+  file<> file_;
+};
+
+class baseline {
+ public:
+  baseline() {
+    auto path = std::getenv("BASELINE");
+    if (!path) {
+      return;
+    }
+    static const std::regex record{
+        R"re(\{"name": "([^"]+)", "types": (\d+), "time": ([\d.e+-]+), .*"rss": (\d+), "object": (\d+)\})re"};
+    const auto data = read_file(path);
+    for (auto it = std::sregex_iterator{data.begin(), data.end(), record}; it != std::sregex_iterator{}; ++it) {
+      stats s{};
+      s.time = std::stod((*it)[3]);
+      s.rss = std::stol((*it)[4]);
+      s.object = std::stol((*it)[5]);
+      records_[(*it)[1].str() + "/" + (*it)[2].str()] = s;
+    }
+    if (auto tolerance = std::getenv("BASELINE_TOLERANCE")) {
+      tolerance_ = std::stod(tolerance);
+    }
+  }
+
+  void verify(const std::string& name, int n, const stats& s) const {
+    auto it = records_.find(name + "/" + std::to_string(n));
+    if (it == records_.end()) {
+      return;
+    }
+    auto regressed = [&](auto current, auto previous) { return current > previous * (1.0 + tolerance_); };
+    if (regressed(s.time, it->second.time) || regressed(s.rss, it->second.rss)) {
+      std::printf("%s/%d: time %f [%f], rss %ld [%ld]\n", name.c_str(), n, s.time, it->second.time, s.rss, it->second.rss);
+      expect(false);
+    }
+  }
+
+ private:
+  std::map<std::string, stats> records_;
+  double tolerance_ = 0.2;
+};
+
 auto benchmark = [](const std::string& complexity, bool interfaces = false, int modules_min = 0, int modules_max = 10) {
   auto perform = [&](auto& ds, auto name, auto create, auto configure) {
     auto _ = series{ds, name};
@@ -294,6 +630,77 @@ auto benchmark = [](const std::string& complexity, bool interfaces = false, int
   perform(ds, "inject/exposed", generator::config_create::INJECT, generator::config_configure::EXPOSED);
 };
 
+auto bindings_benchmark = [](const std::string& complexity, std::initializer_list<int> bindings) {
+  json ds{complexity};
+  auto _ = series{ds, "bindings"};
+  for (auto n : bindings) {
+    auto file = bindings_generator{n}.generate();
+    ds.data(n, measure(file));
+  }
+};
+
+auto ctor_limit_benchmark = [](const std::string& complexity, std::initializer_list<int> ctor_args,
+                               std::initializer_list<int> limits) {
+  json ds{complexity, "BOOST_DI_CFG_CTOR_LIMIT_SIZE"};
+  for (auto args : ctor_args) {
+    auto _ = series{ds, "up to " + std::to_string(args) + " ctor parameters"};
+    auto file = ctor_generator{args}.generate();
+    for (auto limit : limits) {
+      if (args <= limit) {
+        ds.data(limit, measure(file, "-DBOOST_DI_CFG_CTOR_LIMIT_SIZE=" + std::to_string(limit)));
+      }
+    }
+  }
+};
+
+auto ctor_deduction_benchmark = [](const std::string& complexity, int ctor_args, std::initializer_list<int> types) {
+  auto perform = [&](auto& ds, auto name, auto ctor) {
+    auto _ = series{ds, name};
+    for (auto n : types) {
+      auto file = ctor_generator{ctor_args, ctor, n}.generate();
+      ds.data(n, measure(file));
+    }
+  };
+
+  json ds{complexity, "Number of types"};
+  perform(ds, "ctor/auto", ctor_generator::config_ctor::CTOR);
+  perform(ds, "ctor/legacy", ctor_generator::config_ctor::CTOR_LEGACY);
+  perform(ds, "ctor/ctor_limit", ctor_generator::config_ctor::CTOR_LIMIT);
+  perform(ds, "aggregate/auto", ctor_generator::config_ctor::AGGREGATE);
+  perform(ds, "aggregate/legacy", ctor_generator::config_ctor::AGGREGATE_LEGACY);
+  perform(ds, "inject", ctor_generator::config_ctor::INJECT);
+};
+
+auto scale_benchmark = [](const std::string& complexity, std::initializer_list<int> types) {
+  auto perform = [&](auto& ds, auto& rs, const auto& bs, auto name, auto create, auto configure, auto interfaces,
+                     auto modules) {
+    auto _ = series{ds, name};
+    for (auto n : types) {
+      auto file = generator{create, configure, interfaces, modules, n}.generate();
+      auto result = measure_stats(file);
+      ds.data(n, result.time);
+      rs.add(name, n, result);
+      bs.verify(name, n, result);
+    }
+  };
+
+  json ds{complexity, "Number of types"};
+  results rs{complexity};
+  baseline bs{};
+  for (auto interfaces : {false, true}) {
+    const std::string prefix = interfaces ? "interfaces/" : "";
+    perform(ds, rs, bs, prefix + "ctor", generator::config_create::CTOR, generator::config_configure::ALL, interfaces, 0);
+    perform(ds, rs, bs, prefix + "inject", generator::config_create::INJECT, generator::config_configure::ALL, interfaces, 0);
+    perform(ds, rs, bs, prefix + "ctor/all", generator::config_create::CTOR, generator::config_configure::ALL, interfaces, 10);
+    perform(ds, rs, bs, prefix + "inject/all", generator::config_create::INJECT, generator::config_configure::ALL, interfaces,
+            10);
+    perform(ds, rs, bs, prefix + "ctor/exposed", generator::config_create::CTOR, generator::config_configure::EXPOSED,
+            interfaces, 10);
+    perform(ds, rs, bs, prefix + "inject/exposed", generator::config_create::INJECT, generator::config_configure::EXPOSED,
+            interfaces, 10);
+  }
+};
+
 auto is_benchmark(const std::string& name) { return std::getenv("BENCHMARK") && std::string{std::getenv("BENCHMARK")} == name; }
 }
 
@@ -309,6 +716,30 @@ test big_complexity = [] {
   }
 };
 
+test bindings_complexity = [] {
+  if (is_benchmark("BINDINGS")) {
+    bindings_benchmark("bindings", {100, 1000, 2500, 5000, 7500, 10000});
+  }
+};
+
+test ctor_limit_complexity = [] {
+  if (is_benchmark("CTOR_LIMIT")) {
+    ctor_limit_benchmark("ctor_limit", {3, 10, 20, 32}, {10, 16, 24, 32});
+  }
+};
+
+test ctor_deduction_complexity = [] {
+  if (is_benchmark("CTOR_DEDUCTION")) {
+    ctor_deduction_benchmark("ctor_deduction", 3 /*max ctor args*/, {100, 250, 500, 1000, 2000});
+  }
+};
+
+test scale_complexity = [] {
+  if (is_benchmark("SCALE")) {
+    scale_benchmark("scale", {64, 256, 1024, 4096, 16384});
+  }
+};
+
 test quick = [] {
   if (is_benchmark("QUICK")) {
     benchmark("quick", false /*interfaces*/, 1 /*min modules*/, 1 /*max modules*/);
@@ -137,6 +137,27 @@ test bind_named_int = [] { expect(check_opcodes("bind_named_int")); };
 
 // ---------------------------------------------------------------------------
 
+struct context {
+  explicit context(int value) : value(value) {}
+  int value = 0;
+};
+
+auto given_bind_contextual_int() {
+  auto injector = di::make_injector(di::bind<int>().to(0), di::bind<int>().when<context>().to(42));
+
+  return injector.create<context>().value;
+}
+
+auto expected_bind_contextual_int() {
+  auto injector = di::make_injector(di::bind<int>().to(42));
+
+  return injector.create<context>().value;
+}
+
+test bind_contextual_int = [] { expect(check_opcodes("bind_contextual_int")); };
+
+// ---------------------------------------------------------------------------
+
 auto given_module_no_bindings() {
   auto module = [] { return di::make_injector(); };
 
@@ -172,4 +193,20 @@ test module_bind_int = [] { expect(check_opcodes("module_bind_int")); };
 
 // ---------------------------------------------------------------------------
 
+struct config {
+  config() : value(42) {}
+  int value;
+};
+
+auto given_bind_injector_singleton() {
+  auto injector = di::make_injector(di::bind<config>().in(di::injector_singleton));
+  return injector.create<config&>().value;
+}
+
+auto expected_bind_injector_singleton() { return 42; }
+
+test bind_injector_singleton = [] { expect(check_opcodes("bind_injector_singleton")); };
+
+// ---------------------------------------------------------------------------
+
 #endif
@@ -24,6 +24,8 @@ test args_size = [] {
   expect(1 == BOOST_DI_SIZE(p1));
   expect(3 == BOOST_DI_SIZE(p1, p2, p3));
   expect(10 == BOOST_DI_SIZE(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+  expect(32 == BOOST_DI_SIZE(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22,
+                             p23, p24, p25, p26, p27, p28, p29, p30, p31, p32));
 };
 
 test is_bracket = [] {
@@ -37,6 +39,8 @@ test arg = [] {
   expect(1 == BOOST_DI_ELEM(0, 1, 2, 3, ...));
   expect(2 == BOOST_DI_ELEM(1, 1, 2, 3, ...));
   expect(3 == BOOST_DI_ELEM(2, 1, 2, 3, ...));
+  expect(32 == BOOST_DI_ELEM(31, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                             28, 29, 30, 31, 32, ...));
 };
 
 test eval_repeat = [] {
@@ -47,6 +51,8 @@ test eval_repeat = [] {
   expect(std::string{"0"} == Q(BOOST_DI_REPEAT(1, M, ...)));
   expect(std::string{"0 1"} == Q(BOOST_DI_REPEAT(2, M, ...)));
   expect(std::string{"0 1 2"} == Q(BOOST_DI_REPEAT(3, M, ...)));
+  expect(std::string{"0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31"} ==
+         Q(BOOST_DI_REPEAT(32, M, ...)));
 #undef M
 #undef Q
 #undef Q_IMPL
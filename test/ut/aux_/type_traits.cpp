@@ -98,6 +98,34 @@ test is_braces_constructible_types = [] {
   static_expect(is_braces_constructible<agg3, int, double, float>::value);
 };
 
+test is_nothrow_move_constructible_types = [] {
+  struct nothrow {
+    nothrow(nothrow&&) noexcept {}
+  };
+  struct throwing {
+    throwing(throwing&&) {}
+  };
+  struct non_movable {
+    non_movable(non_movable&&) = delete;
+  };
+
+  static_expect(is_nothrow_move_constructible<int>::value);
+  static_expect(is_nothrow_move_constructible<nothrow>::value);
+  static_expect(!is_nothrow_move_constructible<throwing>::value);
+  static_expect(!is_nothrow_move_constructible<non_movable>::value);
+};
+
+test is_empty_types = [] {
+  struct empty {};
+  struct non_empty {
+    int i = 0;
+  };
+
+  static_expect(is_empty<empty>::value);
+  static_expect(!is_empty<non_empty>::value);
+  static_expect(!is_empty<int>::value);
+};
+
 test is_narrowed_types = [] {
   static_expect(!is_narrowed<int, int>::value);
   static_expect(!is_narrowed<float, float>::value);
@@ -135,6 +163,7 @@ test remove_smart_ptr_types = [] {
   static_expect(std::is_same<int, remove_smart_ptr_t<std::shared_ptr<int>>>::value);
   static_expect(std::is_same<int, remove_smart_ptr_t<boost::shared_ptr<int>>>::value);
   static_expect(std::is_same<int, remove_smart_ptr_t<std::weak_ptr<int>>>::value);
+  static_expect(std::is_same<int, remove_smart_ptr_t<boost::intrusive_ptr<int>>>::value);
 };
 
 test remove_qualifiers_types = [] {
@@ -152,6 +181,7 @@ test deref_types = [] {
   static_expect(std::is_same<typename deref_type<std::shared_ptr<int>>::type, int>::value);
   static_expect(std::is_same<typename deref_type<boost::shared_ptr<int>>::type, int>::value);
   static_expect(std::is_same<typename deref_type<std::weak_ptr<int>>::type, int>::value);
+  static_expect(std::is_same<typename deref_type<boost::intrusive_ptr<int>>::type, int>::value);
 };
 
 test decay_types = [] {
@@ -170,6 +200,12 @@ test decay_types = [] {
     static_expect(std::is_same<T, decay_t<std::shared_ptr<T>&>>::value);
     static_expect(std::is_same<T, decay_t<boost::shared_ptr<T>&>>::value);
     static_expect(std::is_same<T, decay_t<T&&>>::value);
+    static_expect(std::is_same<T, decay_t<poly<T, 16>>>::value);
+    static_expect(std::is_same<T, decay_t<const poly<T, 16>&>>::value);
+    static_expect(std::is_same<T, decay_t<borrowed<T>>>::value);
+    static_expect(std::is_same<T, decay_t<const borrowed<T>&>>::value);
+    static_expect(std::is_same<T, decay_t<boost::intrusive_ptr<T>>>::value);
+    static_expect(std::is_same<T, decay_t<const boost::intrusive_ptr<T>&>>::value);
     static_expect(std::is_same<core::array<T>, decay_t<std::vector<std::shared_ptr<T>>>>::value);
     static_expect(std::is_same<core::array<T>, decay_t<std::shared_ptr<std::vector<std::shared_ptr<T>>>>>::value);
     static_expect(std::is_same<core::array<T>, decay_t<std::set<std::shared_ptr<T>>>>::value);
@@ -264,6 +300,7 @@ test is_unique_types = [] {
   static_expect(!is_unique<int, double, double, int, int>::value);
   static_expect(std::is_same<not_unique<int>, is_unique<int, int>::type>::value);
   static_expect(std::is_same<not_unique<int>, is_unique<float, int, double, int>::type>::value);
+  static_expect(std::is_same<not_unique<>, is_unique<type<int>, type<int, int>, int&, const int>::type>::value);
 };
 
 test unique_types = [] {
@@ -21,6 +21,8 @@ test index_sequence_types = [] {
   static_expect(std::is_same<index_sequence<0, 1, 2, 3, 4, 5, 6, 7>, make_index_sequence<8>>::value);
   static_expect(std::is_same<index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8>, make_index_sequence<9>>::value);
   static_expect(std::is_same<index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8, 9>, make_index_sequence<10>>::value);
+  static_expect(std::is_same<index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22>,
+                             make_index_sequence<23>>::value);
 };
 
 test join_types = [] {
@@ -31,4 +33,22 @@ test join_types = [] {
   static_expect(std::is_same<type_list<float, double>, join_t<type_list<>, type_list<float, double>>>::value);
 };
 
+test join_many_types = [] {
+  using l = type_list<int, double>;
+  static_expect(std::is_same<type_list<int, double, int, double, int, double, float>,
+                             join_t<l, l, type_list<>, l, type_list<float>>>::value);
+  static_expect(std::is_same<type_list<int, double, int, double, int, double, int, double, int, double, int, double, int, double,
+                                       int, double, int, double, int, double, int, double, int, double, int, double, int, double,
+                                       int, double, int, double, int, double, float>,
+                             join_t<l, l, l, l, l, l, l, l, l, l, l, l, l, l, l, l, l, type_list<>, type_list<float>>>::value);
+};
+
+test join_many_types_in_order = [] {
+  static_expect(std::is_same<type_list<int, float, double>,
+                             join_t<type_list<>, type_list<int>, type_list<float>, type_list<>, type_list<double>>>::value);
+  static_expect(std::is_same<type_list<char, short, int, long, float, double, void>,
+                             join_t<type_list<char>, type_list<short, int>, type_list<long>, type_list<>, type_list<float>,
+                                    type_list<double>, type_list<>, type_list<void>, type_list<>>>::value);
+};
+
 }  // aux
@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <type_traits>
+#include "boost/di/borrowed.hpp"
+
+struct i {
+  virtual ~i() noexcept = default;
+  virtual int get() const = 0;
+};
+
+struct impl : i {
+  int get() const override { return 42; }
+};
+
+test empty = [] {
+  borrowed<int> object;
+  expect(!object);
+  expect(!object.get());
+};
+
+test from_reference = [] {
+  auto i = 42;
+  borrowed<int> object{i};
+  expect(object);
+  expect(&i == object.get());
+  expect(42 == *object);
+  *object = 87;
+  expect(87 == i);
+};
+
+test to_interface = [] {
+  impl object;
+  borrowed<i> object_ = borrowed<impl>{object};
+  expect(&object == object_.get());
+  expect(42 == object_->get());
+};
+
+test copy = [] {
+  impl object;
+  borrowed<i> object1{object};
+  auto object2 = object1;
+  expect(object1.get() == object2.get());
+  static_expect(std::is_trivially_copyable<borrowed<i>>::value);
+  static_expect(sizeof(borrowed<i>) == sizeof(i*));
+};
+
+test not_convertible = [] {
+  static_expect(!std::is_convertible<int&, borrowed<int>>::value);
+  static_expect(!std::is_convertible<borrowed<i>, borrowed<impl>>::value);
+  static_expect(std::is_convertible<borrowed<impl>, borrowed<i>>::value);
+};
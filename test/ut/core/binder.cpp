@@ -52,6 +52,45 @@ test resolve_types_found_by_name = [] {
   expect(std::is_same<result, dependency<scopes::unique, int, int, name>>{});
 };
 
+test resolve_types_found_by_parent = [] {
+  struct parent {};
+  struct other {};
+  struct deps : dependency<scopes::unique, int, int, contextual<parent, no_name>>, dependency<scopes::unique, int> {};
+
+  {
+    using result = std::remove_reference_t<decltype(
+        binder::resolve<int, no_name, dependency<scopes::deduce, int>, parent>((deps*)nullptr))>;
+    expect(std::is_same<result, dependency<scopes::unique, int, int, contextual<parent, no_name>>>{});
+  }
+
+  {
+    using result = std::remove_reference_t<decltype(
+        binder::resolve<int, no_name, dependency<scopes::deduce, int>, other>((deps*)nullptr))>;
+    expect(std::is_same<result, dependency<scopes::unique, int>>{});
+  }
+
+  {
+    using result = std::remove_reference_t<decltype(binder::resolve<int>((deps*)nullptr))>;
+    expect(std::is_same<result, dependency<scopes::unique, int>>{});
+  }
+};
+
+test resolve_types_found_by_parent_and_name = [] {
+  struct parent {};
+  struct name {};
+  struct deps : dependency<scopes::unique, int, int, contextual<parent, name>> {};
+
+  {
+    using result = binder::resolve_t<deps, int, name, dependency<scopes::deduce, int>, parent>;
+    expect(std::is_same<result, dependency<scopes::unique, int, int, contextual<parent, name>>>{});
+  }
+
+  {
+    using result = binder::resolve_t<deps, int, no_name, dependency<scopes::deduce, int>, parent>;
+    expect(std::is_same<result, dependency<scopes::deduce, int>>{});
+  }
+};
+
 test resolve_types_found_many = [] {
   struct not_resolved {};
   struct deps : dependency<scopes::unique, int>, dependency<scopes::unique, double>, dependency<scopes::unique, float> {};
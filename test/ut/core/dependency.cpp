@@ -47,6 +47,17 @@ test named = [] {
   expect(std::is_same<name, typename dep2::name>::value);
 };
 
+test when = [] {
+  struct parent {};
+  using dep1 = dependency<scopes::deduce, int>;
+
+  using dep2 = decltype(dep1{}.when<parent>());
+  expect(std::is_same<contextual<parent, no_name>, typename dep2::name>::value);
+
+  using dep3 = decltype(dep1{}.named(name{}).when<parent>());
+  expect(std::is_same<contextual<parent, name>, typename dep3::name>::value);
+};
+
 test in = [] {
   using dep1 = dependency<fake_scope<>, int>;
   expect(std::is_same<fake_scope<>, typename dep1::scope>::value);
@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "boost/di/core/objects.hpp"
+
+namespace core {
+
+struct c {
+  static auto& dtor_calls() {
+    static auto calls = 0;
+    return calls;
+  }
+
+  explicit c(int i) : i(i) {}
+  ~c() { ++dtor_calls(); }
+  int i = 0;
+};
+
+auto make_objects(decltype(sizeof(0)) size) {
+  return objects<c>{size, [](void* memory, decltype(sizeof(0)) size, decltype(sizeof(0))& created) {
+                      for (; created < size; ++created) {
+                        new (static_cast<objects<c>::element*>(memory) + created) objects<c>::element{c{int(created)}};
+                      }
+                    }};
+}
+
+test empty = [] {
+  auto objects = make_objects(0);
+  expect(objects.empty());
+  expect(0 == objects.size());
+  expect(objects.begin() == objects.end());
+};
+
+test contiguous = [] {
+  auto objects = make_objects(3);
+  expect(3 == objects.size());
+  expect(objects.data() == objects.begin());
+  expect(objects.begin() + 3 == objects.end());
+  for (auto i = 0; i < 3; ++i) {
+    expect(i == objects[i].i);
+  }
+};
+
+test destroy = [] {
+  {
+    auto objects = make_objects(2);
+    c::dtor_calls() = 0;
+  }
+  expect(2 == c::dtor_calls());
+};
+
+test move = [] {
+  auto objects1 = make_objects(2);
+  auto objects2 = static_cast<objects<c>&&>(objects1);
+  expect(objects1.empty());
+  expect(2 == objects2.size());
+  expect(1 == objects2[1].i);
+};
+
+}  // core
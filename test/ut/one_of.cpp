@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <new>
+#include <type_traits>
+#include "boost/di/one_of.hpp"
+
+struct c1 {
+  explicit c1(int i) : i(i) {}
+  int get() const { return i; }
+  int i = 0;
+};
+
+struct c2 {
+  static int& instances() {
+    static auto instances = 0;
+    return instances;
+  }
+
+  c2() { ++instances(); }
+  c2(c2&&) noexcept { ++instances(); }
+  ~c2() noexcept { --instances(); }
+  int get() const { return 87; }
+  double d = 0.0;
+};
+
+struct fake_injector {
+  template <class T>
+  T& create_at(void* memory) const {
+    return *new (memory) T{};
+  }
+};
+
+template <>
+c1& fake_injector::create_at<c1>(void* memory) const {
+  return *new (memory) c1{42};
+}
+
+using one_of_t = one_of<c1, c2>;
+
+test storage = [] {
+  static_expect(sizeof(one_of_t) == sizeof(double) + sizeof(decltype(sizeof(0))));
+  static_expect(alignof(one_of_t) >= alignof(double));
+  static_expect(!std::is_copy_constructible<one_of_t>::value);
+  static_expect(std::is_nothrow_move_constructible<one_of_t>::value);
+};
+
+test move_noexcept = [] {
+  struct throwing {
+    throwing() = default;
+    throwing(throwing&&) {}
+  };
+
+  static_expect(!std::is_nothrow_move_constructible<one_of<c1, throwing>>::value);
+  static_expect(std::is_move_constructible<one_of<c1, throwing>>::value);
+};
+
+test create = [] {
+  one_of_t object{0, fake_injector{}};
+  expect(0 == object.index());
+  expect(object.get_if<c1>());
+  expect(!object.get_if<c2>());
+  expect(42 == object.get_if<c1>()->get());
+};
+
+test visit = [] {
+  one_of_t object1{0, fake_injector{}};
+  expect(42 == object1.visit([](auto& object) { return object.get(); }));
+
+  const one_of_t object2{1, fake_injector{}};
+  expect(87 == object2.visit([](const auto& object) { return object.get(); }));
+  expect(object2.get_if<c2>());
+};
+
+test move_and_destroy = [] {
+  {
+    one_of_t object1{1, fake_injector{}};
+    expect(1 == c2::instances());
+    one_of_t object2{static_cast<one_of_t&&>(object1)};
+    expect(1 == object2.index());
+    expect(2 == c2::instances());
+  }
+  expect(!c2::instances());
+};
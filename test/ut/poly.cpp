@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <utility>
+#include "boost/di/poly.hpp"
+
+struct i {
+  virtual ~i() noexcept = default;
+  virtual int get() const = 0;
+};
+
+struct impl : i {
+  static auto& instances() {
+    static auto instances = 0;
+    return instances;
+  }
+
+  explicit impl(int value) : value(value) { ++instances(); }
+  impl(impl&& other) noexcept : value(other.value) { ++instances(); }
+  ~impl() noexcept { --instances(); }
+  int get() const override { return value; }
+
+  int value = 0;
+};
+
+struct big : impl {
+  using impl::impl;
+  char data[64];
+};
+
+struct throwing : i {
+  throwing() = default;
+  throwing(throwing&&) {}
+  int get() const override { return 0; }
+};
+
+template <class T>
+auto make_inlined(int value) {
+  return poly<i, 16>{aux::type<T>{},
+                     [&](void* memory) { return &(new (memory) type_traits::placement::direct<T>(value))->object; }};
+}
+
+test empty = [] {
+  poly<i, 16> object;
+  expect(!object);
+  expect(!object.get());
+  expect(!object.inlined());
+};
+
+test fits = [] {
+  static_expect(poly<i, 16>::fits<impl>::value);
+  static_expect(!poly<i, 16>::fits<big>::value);
+  static_expect(poly<i, sizeof(big)>::fits<big>::value);
+  static_expect(!poly<i, 16>::fits<throwing>::value);
+};
+
+test create_inlined = [] {
+  impl::instances() = 0;
+  {
+    auto object = make_inlined<impl>(42);
+    expect(object);
+    expect(object.inlined());
+    expect(42 == object->get());
+    expect(static_cast<void*>(object.get()) >= static_cast<void*>(&object));
+    expect(static_cast<void*>(object.get()) < static_cast<void*>(&object + 1));
+    expect(1 == impl::instances());
+  }
+  expect(0 == impl::instances());
+};
+
+test create_allocated = [] {
+  impl::instances() = 0;
+  {
+    poly<i, 16> object{new big{87}};
+    expect(object);
+    expect(!object.inlined());
+    expect(87 == (*object).get());
+    expect(1 == impl::instances());
+  }
+  expect(0 == impl::instances());
+};
+
+test move_inlined = [] {
+  impl::instances() = 0;
+  {
+    auto object = make_inlined<impl>(42);
+    auto moved = std::move(object);
+    expect(!object);
+    expect(moved.inlined());
+    expect(42 == moved->get());
+    expect(static_cast<void*>(moved.get()) >= static_cast<void*>(&moved));
+    expect(static_cast<void*>(moved.get()) < static_cast<void*>(&moved + 1));
+    expect(1 == impl::instances());
+  }
+  expect(0 == impl::instances());
+};
+
+test move_allocated = [] {
+  impl::instances() = 0;
+  {
+    auto ptr = new big{87};
+    poly<i, 16> object{ptr};
+    poly<i, 16> moved;
+    moved = std::move(object);
+    expect(!object);
+    expect(ptr == moved.get());
+    expect(1 == impl::instances());
+    moved = make_inlined<impl>(42);
+    expect(moved.inlined());
+    expect(42 == moved->get());
+    expect(1 == impl::instances());
+  }
+  expect(0 == impl::instances());
+};
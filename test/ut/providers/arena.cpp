@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include "boost/di/aux_/compiler.hpp"
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/providers/arena.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+
+namespace providers {
+
+alignas(8) unsigned char storage[256];
+
+template <class T, class TInit, class... TArgs>
+auto test_arena(const aux::type<T>&, const TInit& init, const TArgs&... args) {
+  monotonic_buffer buffer{storage};
+  {
+    auto object = arena{buffer}.get<T>(init, type_traits::heap{}, args...);
+    expect(object.get());
+    expect(buffer.owns(object.get()));
+    expect(buffer.used() >= sizeof(T));
+  }
+  buffer.release();
+  expect(!buffer.used());
+}
+
+test get_no_args = [] {
+  struct c {};
+  test_arena(aux::type<int>{}, type_traits::direct{});
+  test_arena(aux::type<int>{}, type_traits::uniform{});
+  test_arena(aux::type<c>{}, type_traits::direct{});
+  test_arena(aux::type<c>{}, type_traits::uniform{});
+};
+
+test get_with_args = [] {
+  struct direct {
+    direct(int, double) {}
+  };
+  struct uniform {
+    int i = 0;
+    double d = 0.0;
+  };
+  test_arena(aux::type<direct>{}, type_traits::direct{}, int{}, double{});
+  test_arena(aux::type<direct>{}, type_traits::uniform{}, int{}, double{});
+#if !defined(__MSVC__)
+  test_arena(aux::type<uniform>{}, type_traits::uniform{}, int{}, double{});
+#endif
+};
+
+test get_stack = [] {
+  monotonic_buffer buffer{storage};
+  expect(42 == arena{buffer}.get<int>(type_traits::direct{}, type_traits::stack{}, 42));
+  expect(42 == arena{buffer}.get<int>(type_traits::uniform{}, type_traits::stack{}, 42));
+  expect(!buffer.used());
+};
+
+test get_aligned = [] {
+  struct alignas(16) c {
+    char data[3];
+  };
+  monotonic_buffer buffer{storage};
+  auto object1 = arena{buffer}.get<char>(type_traits::direct{}, type_traits::heap{});
+  auto object2 = arena{buffer}.get<c>(type_traits::direct{}, type_traits::heap{});
+  expect(buffer.owns(object2.get()));
+  expect(!(reinterpret_cast<decltype(sizeof(0))>(object2.get()) % alignof(c)));
+};
+
+test get_when_buffer_is_exhausted = [] {
+  struct c {
+    char data[sizeof(storage) + 1];
+  };
+  monotonic_buffer buffer{storage};
+  auto object = arena{buffer}.get<c>(type_traits::direct{}, type_traits::heap{});
+  expect(object.get());
+  expect(!buffer.owns(object.get()));
+  expect(!buffer.used());
+};
+
+test destroy_objects_in_arena = [] {
+  static auto dtor_calls = 0;
+  struct c {
+    ~c() noexcept { ++dtor_calls; }
+  };
+  monotonic_buffer buffer{storage};
+  { auto object = arena{buffer}.get<c>(type_traits::direct{}, type_traits::heap{}); }
+  expect(1 == dtor_calls);
+};
+
+}  // providers
@@ -23,6 +23,29 @@ auto test_stack(const aux::type<T>&, const TInit& init, const TArgs&... args) {
   (void)object;
 }
 
+template <class T, class TInit, class... TArgs>
+auto test_placement(const aux::type<T>&, const TInit& init, const TArgs&... args) {
+  alignas(T) unsigned char buffer[sizeof(T)];
+  T* object = stack_over_heap{}.get<T>(init, type_traits::placement{buffer}, args...);
+  expect(static_cast<void*>(object) == static_cast<void*>(buffer));
+  object->~T();
+}
+
+template <class T, class TInit, class... TArgs>
+auto test_small_buffer(const aux::type<T>&, const TInit& init, const TArgs&... args) {
+  poly<T, sizeof(T)> object = stack_over_heap{}.get<T>(init, type_traits::small_buffer<T, sizeof(T)>{}, args...);
+  expect(object.inlined());
+  poly<T, 1> allocated = stack_over_heap{}.get<T>(init, type_traits::small_buffer<T, 1>{}, args...);
+  expect(!allocated.inlined() || sizeof(T) <= 1);
+}
+
+template <class T, class TInit, class... TArgs>
+auto test_shared(const aux::type<T>&, const TInit& init, const TArgs&... args) {
+  std::shared_ptr<T> object = stack_over_heap{}.get<T>(init, type_traits::shared{}, args...);
+  expect(object.get());
+  expect(1 == object.use_count());
+}
+
 test get_no_args = [] {
   struct c {};
   test_stack(aux::type<int>{}, type_traits::direct{});
@@ -32,6 +55,12 @@ test get_no_args = [] {
   test_stack(aux::type<c>{}, type_traits::direct{});
   test_heap(aux::type<c>{}, type_traits::uniform{});
   test_stack(aux::type<c>{}, type_traits::uniform{});
+  test_placement(aux::type<int>{}, type_traits::direct{});
+  test_placement(aux::type<c>{}, type_traits::uniform{});
+  test_small_buffer(aux::type<int>{}, type_traits::direct{});
+  test_small_buffer(aux::type<c>{}, type_traits::uniform{});
+  test_shared(aux::type<int>{}, type_traits::direct{});
+  test_shared(aux::type<c>{}, type_traits::uniform{});
 };
 
 test get_with_args = [] {
@@ -44,8 +73,13 @@ test get_with_args = [] {
   };
   test_stack(aux::type<direct>{}, type_traits::direct{}, int{}, double{});
   test_heap(aux::type<direct>{}, type_traits::uniform{}, int{}, double{});
+  test_placement(aux::type<direct>{}, type_traits::direct{}, int{}, double{});
+  test_small_buffer(aux::type<direct>{}, type_traits::direct{}, int{}, double{});
+  test_shared(aux::type<direct>{}, type_traits::direct{}, int{}, double{});
 #if !defined(__MSVC__)
   test_heap(aux::type<uniform>{}, type_traits::uniform{}, int{}, double{});
+  test_placement(aux::type<uniform>{}, type_traits::uniform{}, int{}, double{});
+  test_shared(aux::type<uniform>{}, type_traits::uniform{}, int{}, double{});
 #endif
 };
 
@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/di/scopes/concurrent_scoped.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace scopes {
+
+test create_concurrent_scoped = [] {
+  concurrent_scoped::scope<int, int> scoped;
+  std::shared_ptr<int> object1 = scoped.create<int, no_name>(fake_provider<int>{});
+  std::shared_ptr<int> object2 = scoped.create<int, no_name>(fake_provider<int>{});
+  expect(object1 == object2);
+};
+
+test create_concurrent_scoped_per_scope = [] {
+  concurrent_scoped::scope<int, int> scoped1;
+  concurrent_scoped::scope<int, int> scoped2;
+  std::shared_ptr<int> object1 = scoped1.create<int, no_name>(fake_provider<int>{});
+  std::shared_ptr<int> object2 = scoped2.create<int, no_name>(fake_provider<int>{});
+  expect(object1 != object2);
+};
+
+struct c {};
+auto has_shared_ptr__(c && ) -> std::false_type;
+
+test create_concurrent_scoped_in_place = [] {
+  concurrent_scoped::scope<c, c> scoped;
+  c& object1 = scoped.create<c, no_name>(fake_provider<c>{});
+  c& object2 = scoped.create<c, no_name>(fake_provider<c>{});
+  expect(&object1 == &object2);
+  expect(static_cast<void*>(&object1) >= static_cast<void*>(&scoped));
+  expect(static_cast<void*>(&object1) < static_cast<void*>(&scoped + 1));
+};
+
+struct d {
+  static auto& ctor_calls() {
+    static std::atomic<int> calls{0};
+    return calls;
+  }
+
+  static auto& dtor_calls() {
+    static auto calls = 0;
+    return calls;
+  }
+
+  d() noexcept {
+    ++ctor_calls();
+    std::this_thread::yield();
+  }
+  d(d&&) noexcept = default;
+  ~d() noexcept { ++dtor_calls(); }
+};
+auto has_shared_ptr__(d && ) -> std::false_type;
+
+test destroy_concurrent_scoped_with_scope = [] {
+  d::ctor_calls() = 0;
+  d::dtor_calls() = 0;
+  {
+    concurrent_scoped::scope<d, d> scoped;
+    (void)static_cast<d&>(scoped.create<d, no_name>(fake_provider<d>{}));
+    expect(0 == d::dtor_calls());
+  }
+
+  expect(1 == d::dtor_calls());
+};
+
+test create_concurrent_scoped_from_many_threads = [] {
+  constexpr auto threads_size = 16;
+  constexpr auto iterations = 64;
+
+  for (auto i = 0; i < iterations; ++i) {
+    d::ctor_calls() = 0;
+    concurrent_scoped::scope<d, d> scoped;
+    std::atomic<bool> start{false};
+    std::vector<d*> objects(threads_size);
+    std::vector<std::thread> threads;
+
+    for (auto t = 0; t < threads_size; ++t) {
+      threads.emplace_back([&, t] {
+        while (!start) {
+          std::this_thread::yield();
+        }
+        objects[t] = &static_cast<d&>(scoped.create<d, no_name>(fake_provider<d>{}));
+      });
+    }
+
+    start = true;
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    expect(1 == d::ctor_calls());
+    for (auto object : objects) {
+      expect(object == objects.front());
+    }
+  }
+};
+
+test create_concurrent_scoped_shared_from_many_threads = [] {
+  constexpr auto threads_size = 16;
+  concurrent_scoped::scope<int, int> scoped;
+  std::vector<std::shared_ptr<int>> objects(threads_size);
+  std::vector<std::thread> threads;
+
+  for (auto t = 0; t < threads_size; ++t) {
+    threads.emplace_back([&, t] { objects[t] = scoped.create<int, no_name>(fake_provider<int>{}); });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& object : objects) {
+    expect(object == objects.front());
+  }
+};
+
+}  // scopes
@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include "boost/di/scopes/injector_singleton.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace scopes {
+
+test create_injector_singleton = [] {
+  injector_singleton::scope<int, int> singleton;
+  std::shared_ptr<int> object1 = singleton.create<int, no_name>(fake_provider<int>{});
+  std::shared_ptr<int> object2 = singleton.create<int, no_name>(fake_provider<int>{});
+  expect(object1 == object2);
+};
+
+test create_injector_singleton_per_scope = [] {
+  injector_singleton::scope<int, int> singleton1;
+  injector_singleton::scope<int, int> singleton2;
+  std::shared_ptr<int> object1 = singleton1.create<int, no_name>(fake_provider<int>{});
+  std::shared_ptr<int> object2 = singleton2.create<int, no_name>(fake_provider<int>{});
+  expect(object1 != object2);
+};
+
+struct c {};
+auto has_shared_ptr__(c && ) -> std::false_type;
+
+test create_injector_singleton_in_place = [] {
+  injector_singleton::scope<c, c> singleton;
+  c& object1 = singleton.create<c, no_name>(fake_provider<c>{});
+  c& object2 = singleton.create<c, no_name>(fake_provider<c>{});
+  expect(&object1 == &object2);
+  expect(static_cast<void*>(&object1) >= static_cast<void*>(&singleton));
+  expect(static_cast<void*>(&object1) < static_cast<void*>(&singleton + 1));
+};
+
+test create_injector_singleton_per_scope_in_place = [] {
+  injector_singleton::scope<c, c> singleton1;
+  injector_singleton::scope<c, c> singleton2;
+  const c& object1 = singleton1.create<c, no_name>(fake_provider<c>{});
+  const c& object2 = singleton2.create<c, no_name>(fake_provider<c>{});
+  expect(&object1 != &object2);
+};
+
+struct d {
+  static auto& dtor_calls() {
+    static auto calls = 0;
+    return calls;
+  }
+
+  ~d() noexcept { ++dtor_calls(); }
+};
+auto has_shared_ptr__(d && ) -> std::false_type;
+
+test destroy_injector_singleton_with_scope = [] {
+  {
+    injector_singleton::scope<d, d> singleton;
+    (void)static_cast<d&>(singleton.create<d, no_name>(fake_provider<d>{}));
+    expect(0 == d::dtor_calls());
+  }
+
+  expect(1 == d::dtor_calls());
+};
+
+}  // scopes
@@ -130,4 +130,38 @@ test exposed_many = [] {
   expect(0.0 == static_cast<double>(instance.create<double, name>(fake_provider<int>{})));
 };
 
+template <int N>
+struct sized_injector : fake_injector<> {
+  explicit sized_injector(int i) : i(i) {}
+
+ protected:
+  using fake_injector<>::create_impl;
+
+  template <class T>
+  auto create_successful_impl(const aux::type<T>&) const noexcept {
+    return T(i);
+  }
+
+  int i = 0;
+  char data[N] = {};
+};
+
+test exposed_move = [] {
+  using scope_t = instance::scope<void, aux::type_list<named<no_name, int>>>;
+  static_expect(sizeof(sized_injector<1>) <= BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE);
+  scope_t instance{sized_injector<1>{42}};
+  expect(42 == static_cast<int>(instance.create<int, no_name>(fake_provider<int>{})));
+  scope_t moved{static_cast<scope_t&&>(instance)};
+  expect(42 == static_cast<int>(moved.create<int, no_name>(fake_provider<int>{})));
+};
+
+test exposed_move_big_injector = [] {
+  using scope_t = instance::scope<void, aux::type_list<named<no_name, int>>>;
+  static_expect(sizeof(sized_injector<BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE>) > BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE);
+  scope_t instance{sized_injector<BOOST_DI_CFG_EXPOSED_INJECTOR_SIZE>{87}};
+  expect(87 == static_cast<int>(instance.create<int, no_name>(fake_provider<int>{})));
+  scope_t moved{static_cast<scope_t&&>(instance)};
+  expect(87 == static_cast<int>(moved.create<int, no_name>(fake_provider<int>{})));
+};
+
 }  // scopes
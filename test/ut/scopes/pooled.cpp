@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/di/scopes/pooled.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace scopes {
+
+test create_pooled = [] {
+  struct c {
+    int i = 0;
+  };
+
+  pooled::scope<c, c> scope;
+  const auto statistics = pooled::statistics<c>();
+  c* ptr = nullptr;
+  {
+    std::unique_ptr<c, pool_return_deleter> object = scope.create<c, no_name>(fake_provider<c>{});
+    ptr = object.get();
+    expect(statistics.misses + 1 == pooled::statistics<c>().misses);
+  }
+
+  std::unique_ptr<c, pool_return_deleter> object = scope.create<c, no_name>(fake_provider<c>{});
+  expect(ptr == object.get());
+  expect(statistics.hits + 1 == pooled::statistics<c>().hits);
+  expect(statistics.misses + 1 == pooled::statistics<c>().misses);
+};
+
+test create_pooled_unique_objects = [] {
+  struct c {};
+  pooled::scope<c, c> scope;
+  std::unique_ptr<c, pool_return_deleter> object1 = scope.create<c, no_name>(fake_provider<c>{});
+  std::unique_ptr<c, pool_return_deleter> object2 = scope.create<c, no_name>(fake_provider<c>{});
+  expect(object1 != object2);
+};
+
+test create_pooled_raw_pointer = [] {
+  struct c {};
+  pooled::scope<c, c> scope;
+  using object_t = decltype(scope.create<c, no_name>(fake_provider<c>{}));
+  static_expect(!aux::is_convertible<object_t, c*>::value);
+  static_expect(!aux::is_convertible<object_t, const c*>::value);
+  static_expect(aux::is_convertible<object_t, std::unique_ptr<c, pool_return_deleter>>::value);
+};
+
+struct reinjected {
+  static auto& ctor_calls() {
+    static auto calls = 0;
+    return calls;
+  }
+
+  static auto& dtor_calls() {
+    static auto calls = 0;
+    return calls;
+  }
+
+  reinjected() { ++ctor_calls(); }
+  reinjected(reinjected&&) { ++ctor_calls(); }
+  ~reinjected() { ++dtor_calls(); }
+};
+
+test create_pooled_reinject = [] {
+  pooled::scope<reinjected, reinjected> scope;
+  (void)static_cast<std::unique_ptr<reinjected, pool_return_deleter>>(
+      scope.create<reinjected, no_name>(fake_provider<reinjected>{}));
+  reinjected::ctor_calls() = 0;
+  reinjected::dtor_calls() = 0;
+  fake_provider<reinjected>::provide_calls() = 0;
+
+  {
+    std::unique_ptr<reinjected, pool_return_deleter> object =
+        scope.create<reinjected, no_name>(fake_provider<reinjected>{});
+    expect(1 == fake_provider<reinjected>::provide_calls());
+    expect(reinjected::ctor_calls() == reinjected::dtor_calls() + 1);
+  }
+
+  expect(reinjected::ctor_calls() == reinjected::dtor_calls());
+};
+
+struct resettable {
+  static auto& reset_calls() {
+    static auto calls = 0;
+    return calls;
+  }
+
+  void reset() {
+    ++reset_calls();
+    i = 0;
+  }
+
+  int i = 0;
+};
+
+test create_pooled_reset = [] {
+  pooled::scope<resettable, resettable> scope;
+  resettable::reset_calls() = 0;
+  fake_provider<resettable>::provide_calls() = 0;
+  {
+    std::unique_ptr<resettable, pool_return_deleter> object = scope.create<resettable, no_name>(fake_provider<resettable>{});
+    object->i = 42;
+  }
+
+  expect(1 == resettable::reset_calls());
+  std::unique_ptr<resettable, pool_return_deleter> object = scope.create<resettable, no_name>(fake_provider<resettable>{});
+  expect(0 == object->i);
+  expect(1 == fake_provider<resettable>::provide_calls());
+};
+
+test create_pooled_bounded = [] {
+  struct c {};
+  pooled::scope<c, c> scope;
+  std::vector<std::unique_ptr<c, pool_return_deleter>> objects;
+  for (auto i = 0; i < BOOST_DI_CFG_POOL_SIZE + 1; ++i) {
+    objects.push_back(scope.create<c, no_name>(fake_provider<c>{}));
+  }
+  objects.clear();
+
+  const auto statistics = pooled::statistics<c>();
+  for (auto i = 0; i < BOOST_DI_CFG_POOL_SIZE + 1; ++i) {
+    objects.push_back(scope.create<c, no_name>(fake_provider<c>{}));
+  }
+  expect(statistics.hits + BOOST_DI_CFG_POOL_SIZE == pooled::statistics<c>().hits);
+  expect(statistics.misses + 1 == pooled::statistics<c>().misses);
+};
+
+test create_pooled_per_thread = [] {
+  struct c {};
+  pooled::scope<c, c> scope;
+  c* ptr = scope.create<c, no_name>(fake_provider<c>{}).object.get();
+  c* other = nullptr;
+  pool_statistics statistics{};
+  std::thread{[&] {
+    std::unique_ptr<c, pool_return_deleter> object = scope.create<c, no_name>(fake_provider<c>{});
+    other = object.get();
+    statistics = pooled::statistics<c>();
+  }}.join();
+
+  expect(ptr != other);
+  expect(0 == statistics.hits);
+  expect(1 == statistics.misses);
+};
+
+test create_pooled_per_scope = [] {
+  struct c {};
+  pooled::scope<c, c> scope1;
+  pooled::scope<c, c> scope2;
+  c* ptr = scope1.create<c, no_name>(fake_provider<c>{}).object.get();
+  const auto statistics = pooled::statistics<c>();
+  std::unique_ptr<c, pool_return_deleter> object = scope2.create<c, no_name>(fake_provider<c>{});
+  expect(ptr != object.get());
+  expect(statistics.hits == pooled::statistics<c>().hits);
+  expect(statistics.misses + 1 == pooled::statistics<c>().misses);
+};
+
+test release_pooled_by_other_thread = [] {
+  struct c {};
+  pooled::scope<c, c> scope;
+  std::unique_ptr<c, pool_return_deleter> object = scope.create<c, no_name>(fake_provider<c>{});
+  pool_statistics statistics{};
+  std::thread{[&] {
+    object.reset();
+    std::unique_ptr<c, pool_return_deleter> other = scope.create<c, no_name>(fake_provider<c>{});
+    statistics = pooled::statistics<c>();
+  }}.join();
+
+  expect(0 == statistics.hits);
+  expect(1 == statistics.misses);
+};
+
+test release_pooled_after_scope = [] {
+  reinjected::ctor_calls() = 0;
+  reinjected::dtor_calls() = 0;
+  std::unique_ptr<reinjected, pool_return_deleter> object;
+  {
+    pooled::scope<reinjected, reinjected> scope;
+    object = scope.create<reinjected, no_name>(fake_provider<reinjected>{});
+    (void)static_cast<std::unique_ptr<reinjected, pool_return_deleter>>(
+        scope.create<reinjected, no_name>(fake_provider<reinjected>{}));
+  }
+
+  object.reset();
+  expect(reinjected::ctor_calls() == reinjected::dtor_calls());
+};
+
+}  // scopes
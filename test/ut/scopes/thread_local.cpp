@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "boost/di/scopes/thread_local.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace scopes {
+
+test create_thread_local = [] {
+  thread_local_::scope<int, int> scope;
+  std::shared_ptr<int> object1 = scope.create<int, no_name>(fake_provider<int>{});
+  std::shared_ptr<int> object2 = scope.create<int, no_name>(fake_provider<int>{});
+  expect(object1 == object2);
+};
+
+test create_thread_local_per_scope = [] {
+  thread_local_::scope<int, int> scope1;
+  thread_local_::scope<int, int> scope2;
+  std::shared_ptr<int> object1 = scope1.create<int, no_name>(fake_provider<int>{});
+  std::shared_ptr<int> object2 = scope2.create<int, no_name>(fake_provider<int>{});
+  expect(object1 != object2);
+};
+
+test create_thread_local_per_thread = [] {
+  thread_local_::scope<int, int> scope;
+  std::shared_ptr<int> object1 = scope.create<int, no_name>(fake_provider<int>{});
+  std::shared_ptr<int> object2;
+  std::shared_ptr<int> object3;
+  std::thread{[&] {
+    object2 = scope.create<int, no_name>(fake_provider<int>{});
+    object3 = scope.create<int, no_name>(fake_provider<int>{});
+  }}.join();
+  expect(object1 != object2);
+  expect(object2 == object3);
+  std::shared_ptr<int> object4 = scope.create<int, no_name>(fake_provider<int>{});
+  expect(object1 == object4);
+};
+
+struct c {};
+auto has_shared_ptr__(c && ) -> std::false_type;
+
+test create_thread_local_in_place = [] {
+  thread_local_::scope<c, c> scope;
+  c& object1 = scope.create<c, no_name>(fake_provider<c>{});
+  c& object2 = scope.create<c, no_name>(fake_provider<c>{});
+  expect(&object1 == &object2);
+};
+
+test create_thread_local_in_place_per_thread = [] {
+  thread_local_::scope<c, c> scope;
+  c* object1 = &static_cast<c&>(scope.create<c, no_name>(fake_provider<c>{}));
+  c* object2 = nullptr;
+  std::thread{[&] { object2 = &static_cast<c&>(scope.create<c, no_name>(fake_provider<c>{})); }}.join();
+  expect(object1 != object2);
+};
+
+test create_thread_local_in_place_alternating_scopes = [] {
+  thread_local_::scope<c, c> scope1;
+  c* object1 = &static_cast<c&>(scope1.create<c, no_name>(fake_provider<c>{}));
+  c* object2 = nullptr;
+  {
+    thread_local_::scope<c, c> scope2;
+    object2 = &static_cast<c&>(scope2.create<c, no_name>(fake_provider<c>{}));
+    expect(object1 != object2);
+    expect(object1 == &static_cast<c&>(scope1.create<c, no_name>(fake_provider<c>{})));
+    expect(object2 == &static_cast<c&>(scope2.create<c, no_name>(fake_provider<c>{})));
+  }
+  thread_local_::scope<c, c> scope3;
+  c* object3 = &static_cast<c&>(scope3.create<c, no_name>(fake_provider<c>{}));
+  expect(object1 != object3);
+  expect(object3 == &static_cast<c&>(scope3.create<c, no_name>(fake_provider<c>{})));
+  expect(object1 == &static_cast<c&>(scope1.create<c, no_name>(fake_provider<c>{})));
+};
+
+struct d {
+  static auto& dtor_calls() {
+    static std::atomic<int> calls{0};
+    return calls;
+  }
+
+  d() noexcept = default;
+  d(d&&) noexcept = default;
+  ~d() noexcept { ++dtor_calls(); }
+};
+auto has_shared_ptr__(d && ) -> std::false_type;
+
+test destroy_thread_local_with_scope = [] {
+  d::dtor_calls() = 0;
+  {
+    thread_local_::scope<d, d> scope;
+    (void)static_cast<d&>(scope.create<d, no_name>(fake_provider<d>{}));
+    expect(0 == d::dtor_calls());
+  }
+
+  expect(1 == d::dtor_calls());
+};
+
+test destroy_thread_local_with_thread = [] {
+  d::dtor_calls() = 0;
+  thread_local_::scope<d, d> scope;
+  std::thread{[&] {
+    (void)static_cast<d&>(scope.create<d, no_name>(fake_provider<d>{}));
+    (void)static_cast<d&>(scope.create<d, no_name>(fake_provider<d>{}));
+    expect(0 == d::dtor_calls());
+  }}.join();
+  expect(1 == d::dtor_calls());
+};
+
+test destroy_thread_local_with_scope_created_by_other_thread = [] {
+  d::dtor_calls() = 0;
+  std::mutex mutex;
+  std::condition_variable cv;
+  auto created = false;
+  auto destroyed = false;
+  std::thread thread;
+  {
+    thread_local_::scope<d, d> scope;
+    thread = std::thread{[&] {
+      (void)static_cast<d&>(scope.create<d, no_name>(fake_provider<d>{}));
+      std::unique_lock<std::mutex> lock{mutex};
+      created = true;
+      cv.notify_one();
+      cv.wait(lock, [&] { return destroyed; });
+    }};
+    std::unique_lock<std::mutex> lock{mutex};
+    cv.wait(lock, [&] { return created; });
+  }
+
+  expect(1 == d::dtor_calls());
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    destroyed = true;
+  }
+  cv.notify_one();
+  thread.join();
+  expect(1 == d::dtor_calls());
+};
+
+std::string& dtor_order() {
+  static std::string order;
+  return order;
+}
+
+struct e {
+  ~e() noexcept { dtor_order() += "e"; }
+};
+auto has_shared_ptr__(e && ) -> std::false_type;
+
+struct f {
+  ~f() noexcept { dtor_order() += "f"; }
+};
+auto has_shared_ptr__(f && ) -> std::false_type;
+
+struct f_provider {
+  f get(const type_traits::stack&) const noexcept {
+    (void)static_cast<e&>(scope.create<e, no_name>(fake_provider<e>{}));
+    return {};
+  }
+
+  thread_local_::scope<e, e>& scope;
+};
+
+test destroy_thread_local_with_thread_in_reverse_order_of_creation = [] {
+  thread_local_::scope<e, e> scope_e;
+  thread_local_::scope<f, f> scope_f;
+  std::thread{[&] {
+    (void)static_cast<f&>(scope_f.create<f, no_name>(f_provider{scope_e}));
+    dtor_order().clear();
+  }}.join();
+  expect("fe" == dtor_order());
+};
+
+}  // scopes
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2012-2016 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <type_traits>
+#include <utility>
+#include "boost/di/sealed.hpp"
+
+struct i {
+  virtual ~i() noexcept = default;
+  virtual int get() const = 0;
+};
+
+struct impl final : i {
+  static int& instances() {
+    static auto instances = 0;
+    return instances;
+  }
+
+  impl() { ++instances(); }
+  ~impl() noexcept { --instances(); }
+  int get() const override { return 42; }
+};
+
+struct other : i {
+  int get() const override { return 0; }
+};
+
+test empty = [] {
+  sealed<i, impl> object;
+  expect(!object);
+  expect(!object.get());
+};
+
+test owns = [] {
+  {
+    sealed<i, impl> object{new impl{}};
+    expect(object);
+    expect(42 == object->get());
+    expect(42 == (*object).get());
+    expect(1 == impl::instances());
+  }
+  expect(!impl::instances());
+};
+
+test interface = [] {
+  {
+    sealed<i> object{new impl{}};
+    expect(42 == object->get());
+  }
+  expect(!impl::instances());
+};
+
+test move = [] {
+  {
+    sealed<i, impl> object1{new impl{}};
+    auto ptr = object1.get();
+    auto object2 = std::move(object1);
+    expect(!object1);
+    expect(ptr == object2.get());
+
+    sealed<i, impl> object3{new impl{}};
+    object3 = std::move(object2);
+    expect(ptr == object3.get());
+    expect(1 == impl::instances());
+  }
+  expect(!impl::instances());
+};
+
+test not_copyable = [] {
+  static_expect(!std::is_copy_constructible<sealed<i, impl>>::value);
+  static_expect(sizeof(sealed<i, impl>) == sizeof(impl*));
+};
+
+test type_checked = [] {
+  static_expect(std::is_constructible<sealed<i>, impl*>::value);
+  static_expect(std::is_constructible<sealed<i, impl>, impl*>::value);
+  static_expect(!std::is_constructible<sealed<i, impl>, other*>::value);
+  static_expect(!std::is_constructible<sealed<other, impl>, impl*>::value);
+  static_expect(!std::is_convertible<impl*, sealed<i, impl>>::value);
+};
+
+test traits = [] {
+  static_expect(std::is_same<i, smart_ptr_traits<sealed<i, impl>>::element_type>::value);
+  static_expect(std::is_same<i, aux::decay_t<sealed<i, impl>>>::value);
+};
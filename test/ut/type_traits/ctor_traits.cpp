@@ -21,6 +21,22 @@ struct ctor_traits<traits> {
   BOOST_DI_INJECT_TRAITS();
 };
 
+struct limit {
+  explicit limit(int) {}
+  limit(int, int, int) {}
+};
+
+template <>
+struct ctor_limit<limit> : aux::integral_constant<int, 2> {};
+
+struct aggregate_limit {
+  int i;
+  double d;
+};
+
+template <>
+struct ctor_limit<aggregate_limit> : aux::integral_constant<int, 1> {};
+
 namespace type_traits {
 
 struct ctor_conv {
@@ -132,13 +148,26 @@ test uniforms = [] {
     std::unique_ptr<int> ptr;
     int& i;
   };
+  struct aggregate {
+    int i;
+    double d;
+    std::unique_ptr<int> ptr;
+  };
   test_ctor_traits<empty, uniform>();
+  test_ctor_traits<ctor1, uniform, core::any_type_1st_fwd<ctor1>>();
+  test_ctor_traits<aggregate, uniform, core::any_type_fwd<aggregate>, core::any_type_fwd<aggregate>,
+                   core::any_type_fwd<aggregate>>();
 
 #if !defined(__MSVC__)
   test_ctor_traits<ctor2_ref, uniform, core::any_type_ref_fwd<ctor2_ref>, core::any_type_ref_fwd<ctor2_ref>>();
 #endif
 };
 
+test ctor_limits = [] {
+  test_ctor_traits<limit, direct, core::any_type_1st_fwd<limit>>();
+  test_ctor_traits<aggregate_limit, uniform, core::any_type_1st_fwd<aggregate_limit>>();
+};
+
 test inheriting_ctors = [] {
   struct c0 {
     c0(int, double) {}
@@ -7,9 +7,13 @@
 #include <memory>
 #include <type_traits>
 #include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/poly.hpp"
 #if __has_include(<boost / shared_ptr.hpp>)
 #include <boost/shared_ptr.hpp>
 #endif
+#if __has_include(<boost / intrusive_ptr.hpp>)
+#include <boost/intrusive_ptr.hpp>
+#endif
 #include "common/common.hpp"
 
 namespace type_traits {
@@ -25,23 +29,30 @@ test traits = [] {
   static_expect(std::is_same<stack, memory_traits_t<const int&>>{});
   static_expect(std::is_same<heap, memory_traits_t<int*>>{});
   static_expect(std::is_same<heap, memory_traits_t<const int*>>{});
-  static_expect(std::is_same<heap, memory_traits_t<std::shared_ptr<int>>>{});
-  static_expect(std::is_same<heap, memory_traits_t<const std::shared_ptr<int>&>>{});
+  static_expect(std::is_same<shared, memory_traits_t<std::shared_ptr<int>>>{});
+  static_expect(std::is_same<shared, memory_traits_t<const std::shared_ptr<int>&>>{});
   static_expect(std::is_same<heap, memory_traits_t<std::weak_ptr<int>>>{});
   static_expect(std::is_same<heap, memory_traits_t<const std::weak_ptr<int>&>>{});
   static_expect(std::is_same<stack, memory_traits_t<int&>>{});
   static_expect(std::is_same<heap, memory_traits_t<std::unique_ptr<int>>>{});
   static_expect(std::is_same<heap, memory_traits_t<std::unique_ptr<int, deleter<int>>>>{});
-  static_expect(std::is_same<heap, memory_traits_t<std::shared_ptr<int>>>{});
+  static_expect(std::is_same<shared, memory_traits_t<std::shared_ptr<int>>>{});
   static_expect(std::is_same<heap, memory_traits_t<std::weak_ptr<int>>>{});
   static_expect(std::is_same<stack, memory_traits_t<int&&>>{});
   static_expect(std::is_same<stack, memory_traits_t<const int&&>>{});
   static_expect(std::is_same<heap, memory_traits_t<i>>{});
+  static_expect(std::is_same<small_buffer<i, 16>, memory_traits_t<poly<i, 16>>>{});
+  static_expect(std::is_same<small_buffer<i, 16>, memory_traits_t<const poly<i, 16>&>>{});
 
 #if __has_include(<boost / shared_ptr.hpp>)
   static_expect(std::is_same<heap, memory_traits_t<boost::shared_ptr<int>>>{});
   static_expect(std::is_same<heap, memory_traits_t<const boost::shared_ptr<int>&>>{});
 #endif
+
+#if __has_include(<boost / intrusive_ptr.hpp>)
+  static_expect(std::is_same<heap, memory_traits_t<boost::intrusive_ptr<int>>>{});
+  static_expect(std::is_same<heap, memory_traits_t<const boost::intrusive_ptr<int>&>>{});
+#endif
 };
 
 }  // type_traits
@@ -26,6 +26,8 @@ test traits = [] {
   static_expect(std::is_same<scopes::singleton, scope_traits_t<std::weak_ptr<int>>>{});
   static_expect(std::is_same<scopes::singleton, scope_traits_t<const std::weak_ptr<int>&>>{});
   static_expect(std::is_same<scopes::singleton, scope_traits_t<int&>>{});
+  static_expect(std::is_same<scopes::singleton, scope_traits_t<borrowed<int>>>{});
+  static_expect(std::is_same<scopes::unique, scope_traits_t<boost::intrusive_ptr<int>>>{});
   static_expect(std::is_same<scopes::unique, scope_traits_t<std::unique_ptr<int>>>{});
   static_expect(std::is_same<scopes::unique, scope_traits_t<std::unique_ptr<int, deleter<int>>>>{});
   static_expect(std::is_same<scopes::singleton, scope_traits_t<std::shared_ptr<int>>>{});
@@ -4,7 +4,10 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include <cstdlib>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include "boost/di/aux_/utility.hpp"
 #include "boost/di/wrappers/shared.hpp"
 #if __has_include(<boost / shared_ptr.hpp>)
@@ -12,6 +15,42 @@
 #endif
 #include "common/fakes/fake_scope.hpp"
 
+namespace {
+unsigned long allocations = 0;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  ++allocations;
+  if (auto ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  std::abort();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+template <class T>
+struct handle {
+  explicit handle(T* object) : object(object) {}
+  T* object = nullptr;
+};
+
+template <class T>
+struct shared_handle {
+  explicit shared_handle(const std::shared_ptr<T>& object) : object(object) {}
+  std::shared_ptr<T> object;
+};
+
+template <class T>
+struct smart_ptr_traits<handle<T>> {
+  using element_type = T;
+};
+
+template <class T>
+struct smart_ptr_traits<shared_handle<T>> {
+  using element_type = T;
+};
+
 namespace wrappers {
 
 test to_shared_ptr = [] {
@@ -26,8 +65,64 @@ test to_other_shared_ptr = [] {
   auto object = static_cast<boost::shared_ptr<int>>(shared<fake_scope<>, int>{i});
   expect(i.get() == object.get());
 };
+
+test to_other_shared_ptr_cached = [] {
+  auto i = std::make_shared<int>(42);
+  bridge_cache cache;
+  auto object1 = static_cast<boost::shared_ptr<int>>(shared<fake_scope<>, int>{i, &cache});
+  const auto allocations_ = allocations;
+  auto object2 = static_cast<boost::shared_ptr<int>>(shared<fake_scope<>, int>{i, &cache});
+  expect(allocations_ == allocations);
+  expect(i.get() == object2.get());
+  expect(!object1.owner_before(object2) && !object2.owner_before(object1));
+  expect(2l == i.use_count());
+};
+
+test to_other_shared_ptr_not_cached = [] {
+  auto i = std::make_shared<int>(42);
+  auto object1 = static_cast<boost::shared_ptr<int>>(shared<fake_scope<>, int>{i});
+  const auto allocations_ = allocations;
+  auto object2 = static_cast<boost::shared_ptr<int>>(shared<fake_scope<>, int>{i});
+  expect(allocations_ + 1 == allocations);
+  expect(object1.owner_before(object2) || object2.owner_before(object1));
+};
+
+test to_other_shared_ptr_cache_copy = [] {
+  auto i = std::make_shared<int>(42);
+  bridge_cache cache;
+  auto object1 = static_cast<boost::shared_ptr<int>>(shared<fake_scope<>, int>{i, &cache});
+  const bridge_cache copy{cache};
+  auto object2 = static_cast<boost::shared_ptr<int>>(shared<fake_scope<>, int>{i, &copy});
+  expect(object1.get() == object2.get());
+  expect(object1.owner_before(object2) || object2.owner_before(object1));
+};
 #endif
 
+test to_borrowed = [] {
+  auto i = std::make_shared<int>(42);
+  borrowed<int> object = shared<fake_scope<>, int>{i};
+  expect(i.get() == object.get());
+  expect(1 == i.use_count());
+};
+
+test to_borrowed_from_reference = [] {
+  auto i = 42;
+  borrowed<const int> object = shared<fake_scope<>, int&>{i};
+  expect(&i == object.get());
+};
+
+test to_smart_ptr = [] {
+  auto i = std::make_shared<int>(42);
+  shared_handle<const int> object = shared<fake_scope<>, int>{i};
+  expect(i == object.object);
+  expect(2 == i.use_count());
+};
+
+test to_smart_ptr_not_owned = [] {
+  static_expect(!std::is_convertible<shared<fake_scope<>, int>, handle<int>>::value);
+  static_expect(!std::is_convertible<shared<fake_scope<>, int&>, handle<int>>::value);
+};
+
 test to_weak_ptr = [] {
   std::weak_ptr<int> object;
 
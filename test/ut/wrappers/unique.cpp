@@ -11,6 +11,17 @@
 #endif
 #include "common/fakes/fake_scope.hpp"
 
+template <class T>
+struct handle {
+  explicit handle(T* object) : object(object) {}
+  T* object = nullptr;
+};
+
+template <class T>
+struct smart_ptr_traits<handle<T>> {
+  using element_type = T;
+};
+
 namespace wrappers {
 
 struct interface {
@@ -66,6 +77,18 @@ test to_boost_shared_ptr = [] {
 };
 #endif
 
+test to_smart_ptr = [] {
+  auto u = unique<fake_scope<>, implementation*>{new implementation{}};
+  handle<interface> object = u;
+  expect(dynamic_cast<implementation*>(object.object));
+  delete object.object;
+};
+
+test to_smart_ptr_not_convertible = [] {
+  static_expect(!std::is_convertible<unique<fake_scope<>, int*>, handle<interface>>::value);
+  static_expect(!std::is_convertible<unique<fake_scope<>, int>, handle<int>>::value);
+};
+
 test to_unique_ptr = [] {
   std::unique_ptr<int> object = unique<fake_scope<>, int*>{new int{i}};
   expect(i == *object);
@@ -76,4 +99,77 @@ test to_unique_ptr_from_unique_ptr = [] {
   expect(i == *object);
 };
 
+struct deleter {
+  static auto& calls() {
+    static auto calls = 0;
+    return calls;
+  }
+
+  template <class T>
+  void operator()(T* ptr) const noexcept {
+    ++calls();
+    delete ptr;
+  }
+};
+
+template <class T>
+using unique_ptr = std::unique_ptr<T, deleter>;
+
+test to_value_from_unique_ptr_with_deleter = [] {
+  auto object = static_cast<int>(unique<fake_scope<>, unique_ptr<int>>{unique_ptr<int>{new int{i}}});
+  expect(i == object);
+};
+
+test to_unique_ptr_from_unique_ptr_with_deleter = [] {
+  deleter::calls() = 0;
+  {
+    unique_ptr<interface> object =
+        unique<fake_scope<>, unique_ptr<implementation>>{unique_ptr<implementation>{new implementation{}}};
+    expect(object.get());
+  }
+  expect(1 == deleter::calls());
+};
+
+test to_shared_ptr_from_unique_ptr_with_deleter = [] {
+  deleter::calls() = 0;
+  {
+    std::shared_ptr<interface> object =
+        unique<fake_scope<>, unique_ptr<implementation>>{unique_ptr<implementation>{new implementation{}}};
+    expect(object.get());
+  }
+  expect(1 == deleter::calls());
+};
+
+test to_unique_ptr_with_default_delete_from_unique_ptr_with_deleter = [] {
+  deleter::calls() = 0;
+  {
+    std::unique_ptr<interface> object =
+        unique<fake_scope<>, unique_ptr<implementation>>{unique_ptr<implementation>{new implementation{}}};
+    expect(object.get());
+    expect(1 == deleter::calls());
+  }
+  expect(1 == deleter::calls());
+};
+
+test to_ptr_from_unique_ptr = [] {
+  std::unique_ptr<const interface> object{static_cast<const interface*>(
+      unique<fake_scope<>, std::unique_ptr<implementation>>{std::make_unique<implementation>()})};
+  expect(object.get());
+};
+
+test to_ptr_from_unique_ptr_with_deleter = [] {
+  static_expect(!aux::is_convertible<unique<fake_scope<>, unique_ptr<implementation>>, interface*>::value);
+  static_expect(!aux::is_convertible<unique<fake_scope<>, unique_ptr<implementation>>, const interface*>::value);
+};
+
+test to_unique_ptr_with_default_delete_from_unique_ptr_with_deleter_non_movable = [] {
+  struct non_movable : implementation {
+    non_movable() = default;
+    non_movable(non_movable&&) = delete;
+  };
+
+  static_expect(!aux::is_convertible<unique<fake_scope<>, unique_ptr<non_movable>>, std::unique_ptr<interface>>::value);
+  static_expect(aux::is_convertible<unique<fake_scope<>, unique_ptr<non_movable>>, unique_ptr<interface>>::value);
+};
+
 }  // wrappers
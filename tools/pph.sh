@@ -57,14 +57,23 @@ pph() {
     BOOST_DI_NAMESPACE_BEGIN
     #include "boost/di/config.hpp"
     #include "boost/di/bindings.hpp"
+    #include "boost/di/borrowed.hpp"
     #include "boost/di/inject.hpp"
     #include "boost/di/injector.hpp"
     #include "boost/di/make_injector.hpp"
+    #include "boost/di/one_of.hpp"
+    #include "boost/di/poly.hpp"
+    #include "boost/di/sealed.hpp"
+    #include "boost/di/scopes/concurrent_scoped.hpp"
     #include "boost/di/scopes/deduce.hpp"
+    #include "boost/di/scopes/injector_singleton.hpp"
     #include "boost/di/scopes/instance.hpp"
+    #include "boost/di/scopes/pooled.hpp"
     #include "boost/di/scopes/singleton.hpp"
+    #include "boost/di/scopes/thread_local.hpp"
     #include "boost/di/scopes/unique.hpp"
     #include "boost/di/policies/constructible.hpp"
+    #include "boost/di/providers/arena.hpp"
     #include "boost/di/providers/heap.hpp"
     #include "boost/di/providers/stack_over_heap.hpp"' > tmp.hpp
   cpp -C -P -nostdinc -I. \